@@ -0,0 +1,65 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <chrono>
+#include <cstdio>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace bench {
+
+// Prevent compiler from optimizing out benchmarked expression
+template<typename T>
+inline void do_not_optimize(T const &value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// items is number of operations done by one call of func
+template<typename F>
+inline double run(std::string_view name, std::size_t iterations, F &&func, std::size_t items = 1)
+{
+    using clock = std::chrono::steady_clock;
+
+    // warm up
+    for (std::size_t i = 0; i < iterations / 10; ++i)
+        func();
+
+    auto start = clock::now();
+    for (std::size_t i = 0; i < iterations; ++i)
+        func();
+    auto elapsed = std::chrono::duration<double, std::nano>(clock::now() - start).count();
+
+    auto result = elapsed / static_cast<double>(iterations * items);
+    std::printf("%-48.*s %10.2f ns/op\n", static_cast<int>(name.size()), name.data(), result);
+    return result;
+}
+
+// Run func from several threads at once, report wall time per operation
+template<typename F>
+inline double run_parallel(std::string_view name, unsigned threads, std::size_t iterations, F &&func)
+{
+    using clock = std::chrono::steady_clock;
+
+    std::vector<std::thread> pool;
+    auto start = clock::now();
+    for (auto i = 0u; i < threads; ++i)
+        pool.emplace_back([&func, count = iterations / threads]
+        {
+            for (std::size_t j = 0; j < count; ++j)
+                func();
+        });
+    for (auto &item: pool)
+        item.join();
+    auto elapsed = std::chrono::duration<double, std::nano>(clock::now() - start).count();
+
+    auto result = elapsed / static_cast<double>(iterations);
+    std::printf("%-48.*s %10.2f ns/op (%u threads)\n",
+                static_cast<int>(name.size()), name.data(), result, threads);
+    return result;
+}
+
+} // namespace bench
+
+#endif // BENCH_H
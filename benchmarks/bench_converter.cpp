@@ -0,0 +1,99 @@
+#include "bench.h"
+
+#include <rtti/variant.h>
+
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct Celsius { double value; };
+struct Fahrenheit { double value; };
+struct Kelvin { double value; };
+
+Fahrenheit toFahrenheit(Celsius c)
+{
+    return {c.value * 9 / 5 + 32};
+}
+
+Kelvin toKelvin(Celsius c)
+{
+    return {c.value + 273.15};
+}
+
+struct Rankine { double value; };
+
+Rankine toRankine(Kelvin k)
+{
+    return {k.value * 9 / 5};
+}
+
+} // namespace
+
+int main()
+{
+    constexpr std::size_t Iterations = 10'000'000;
+
+    rtti::MetaType::registerConverter(toFahrenheit);
+    rtti::MetaType::registerConverter(toKelvin);
+
+    auto from = rtti::metaType<Celsius>();
+    auto to = rtti::metaType<Kelvin>();
+    auto none = rtti::metaType<int>();
+
+    bench::run("hasConverter (hit)", Iterations, [&]
+    {
+        bench::do_not_optimize(rtti::MetaType::hasConverter(from, to));
+    });
+
+    bench::run("hasConverter (miss)", Iterations, [&]
+    {
+        bench::do_not_optimize(rtti::MetaType::hasConverter(from, none));
+    });
+
+    rtti::variant v = Celsius{36.6};
+    bench::run("variant::to<T>() via converter", Iterations, [&]
+    {
+        bench::do_not_optimize(v.to<Kelvin>());
+    });
+
+    rtti::MetaType::registerConverter(toRankine);
+    rtti::MetaType::setConverterChaining(true);
+    bench::run("variant::to<T>() via 2-hop chain", Iterations, [&]
+    {
+        bench::do_not_optimize(v.to<Rankine>());
+    });
+    rtti::MetaType::setConverterChaining(false);
+
+    constexpr std::size_t Column = 100'000;
+    std::vector<int> ints(Column, 42);
+    std::vector<double> doubles(Column);
+    rtti::MetaType::registerConverter<int, double>();
+    auto mt_int = rtti::metaType<int>();
+    auto mt_double = rtti::metaType<double>();
+    bench::run("variant::to<double>() from int", Iterations / 10, [&, i = std::size_t{0}]() mutable
+    {
+        auto &item = doubles[i++ % Column];
+        item = rtti::variant{ints[i % Column]}.to<double>();
+        bench::do_not_optimize(item);
+    });
+    bench::run("convert_n int -> double", Iterations / Column, [&]
+    {
+        rtti::MetaType::convert_n(ints.data(), mt_int, doubles.data(), mt_double, Column);
+        bench::do_not_optimize(doubles.data());
+    }, Column);
+
+    std::vector<Celsius> celsius(Column, Celsius{36.6});
+    std::vector<Kelvin> kelvin(Column);
+    bench::run("convert_n Celsius -> Kelvin (converter)", Iterations / Column, [&]
+    {
+        rtti::MetaType::convert_n(celsius.data(), from, kelvin.data(), to, Column);
+        bench::do_not_optimize(kelvin.data());
+    }, Column);
+
+    auto threads = std::max(2u, std::thread::hardware_concurrency());
+    bench::run_parallel("hasConverter (hit), all threads", threads, Iterations, [&]
+    {
+        bench::do_not_optimize(rtti::MetaType::hasConverter(from, to));
+    });
+}
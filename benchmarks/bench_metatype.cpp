@@ -0,0 +1,81 @@
+#include "bench.h"
+
+#include <rtti/metatype.h>
+#include <rtti/memoryresource.h>
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+int main()
+{
+    constexpr std::size_t Count = 1'000'000;
+    constexpr std::size_t Iterations = 100;
+
+    std::vector<double> source(Count, 3.14);
+    std::vector<double> target(Count);
+    auto mt_double = rtti::metaType<double>();
+
+    bench::run("memcpy double", Iterations, [&]
+    {
+        std::memcpy(target.data(), source.data(), Count * sizeof(double));
+        bench::do_not_optimize(target.data());
+    }, Count);
+
+    bench::run("MetaType::copy_n double", Iterations, [&]
+    {
+        mt_double.copy_n(source.data(), target.data(), Count);
+        bench::do_not_optimize(target.data());
+    }, Count);
+
+    bench::run("MetaType::construct_n double", Iterations, [&]
+    {
+        mt_double.construct_n(target.data(), Count);
+        bench::do_not_optimize(target.data());
+    }, Count);
+
+    constexpr std::size_t Strings = 100'000;
+    std::vector<std::string> strings(Strings, "short string");
+    std::allocator<std::string> allocator;
+    auto *raw = allocator.allocate(Strings);
+    auto mt_string = rtti::metaType<std::string>();
+
+    bench::run("MetaType::copy_n + destroy_n std::string", Iterations, [&]
+    {
+        mt_string.copy_n(strings.data(), raw, Strings);
+        mt_string.destroy_n(raw, Strings);
+    }, Strings);
+
+    allocator.deallocate(raw, Strings);
+
+    struct Message { std::string id; std::vector<int> payload; double stamp; };
+    auto mt_message = rtti::metaType<Message>();
+    constexpr std::size_t Objects = 1'000'000;
+
+    bench::run("MetaType::construct/destruct, new/delete", Objects, [&]
+    {
+        mt_message.destruct(mt_message.construct());
+    });
+
+    auto *pool = rtti::poolResource();
+    bench::run("MetaType::construct/destruct, pool", Objects, [&]
+    {
+        mt_message.destruct(mt_message.construct(nullptr, false, pool), pool);
+    });
+
+    rtti::ArenaResource arena{64 * 1024};
+    bench::run("MetaType::construct/destruct, arena", Objects, [&, i = std::size_t{0}]() mutable
+    {
+        mt_message.destruct(mt_message.construct(nullptr, false, &arena), &arena);
+        if (++i % 1000 == 0)
+            arena.release();
+    });
+
+    mt_message.setMemoryResource(pool);
+    bench::run("MetaType::construct/destruct, attached pool", Objects, [&]
+    {
+        mt_message.destruct(mt_message.construct());
+    });
+    mt_message.setMemoryResource(nullptr);
+}
@@ -0,0 +1,218 @@
+#include "bench.h"
+
+#include <rtti/metadefine.h>
+
+#include <string>
+#include <utility>
+
+namespace {
+
+struct Point
+{
+    double x = 0;
+    double y = 0;
+
+    double scale(double factor, int times, std::string const &tag) const
+    { return (x + y) * factor * times + static_cast<double>(tag.size()); }
+};
+
+int sum(int a, int b, int c)
+{
+    return a + b + c;
+}
+
+struct Generated
+{
+    template<std::size_t N>
+    std::size_t method(int) const
+    { return N; }
+};
+
+struct Level0
+{
+    DECLARE_CLASSINFO
+public:
+    int value = 0;
+};
+
+struct Level1: Level0
+{
+    DECLARE_CLASSINFO
+};
+
+struct Level2: Level1
+{
+    DECLARE_CLASSINFO
+};
+
+struct Level3: Level2
+{
+    DECLARE_CLASSINFO
+};
+
+struct VirtualBase
+{
+    DECLARE_CLASSINFO
+};
+
+struct VirtualDerived: virtual VirtualBase
+{
+    DECLARE_CLASSINFO
+};
+
+template<typename D, std::size_t ...I>
+void defineGenerated(D &&define, std::index_sequence<I...>)
+{
+    (define._method("method" + std::to_string(I), &Generated::method<I>), ...);
+}
+
+} // namespace
+
+int main()
+{
+    constexpr std::size_t Iterations = 10'000'000;
+
+    rtti::global_define()
+        ._method("sum", &sum)
+        ._class<Point>("Point")
+            ._method("scale", &Point::scale)
+        ._end()
+    ;
+    rtti::MetaType::registerConverter<float, double>();
+
+    auto *global = rtti::MetaNamespace::global();
+    auto *sumMethod = global->getMethod("sum");
+    bench::run("MetaMethod::invoke, static, 3 int arguments", Iterations, [&]
+    {
+        bench::do_not_optimize(sumMethod->invoke(1, 2, 3));
+    });
+
+    int a = 1, b = 2, c = 3;
+    rtti::variant_ref args[] = {a, b, c};
+    int result = 0;
+    bench::run("MetaMethod::invokeArgs, static, result buffer", Iterations, [&]
+    {
+        sumMethod->invokeArgs(args, &result);
+        bench::do_not_optimize(result);
+    });
+
+    auto sumDelegate = sumMethod->bind<int(int, int, int)>();
+    bench::run("method_delegate, static, 3 int arguments", Iterations, [&]
+    {
+        bench::do_not_optimize(sumDelegate(a, b, c));
+    });
+
+    auto *scaleMethod = rtti::MetaClass::find(rtti::metaTypeId<Point>())->getMethod("scale");
+    rtti::variant point = Point{1, 2};
+    std::string tag = "tag";
+    bench::run("MetaMethod::invoke, member, 3 arguments", Iterations, [&]
+    {
+        bench::do_not_optimize(scaleMethod->invoke(point, 2.0, 3, tag));
+    });
+
+    bench::run("variant::invoke(name), member, 3 arguments", Iterations, [&]
+    {
+        bench::do_not_optimize(point.invoke("scale", 2.0, 3, tag));
+    });
+
+    auto scaleHandle = rtti::method_handle{"scale"};
+    bench::run("method_handle::invoke, member, 3 arguments", Iterations, [&]
+    {
+        bench::do_not_optimize(scaleHandle.invoke(point, 2.0, 3, tag));
+    });
+
+    auto scaleDelegate = scaleMethod->bind<double(Point const&, double, int, std::string const&)>();
+    auto &pointRef = point.cref<Point>();
+    bench::run("method_delegate, member, 3 arguments", Iterations, [&]
+    {
+        bench::do_not_optimize(scaleDelegate(pointRef, 2.0, 3, tag));
+    });
+
+    bench::run("MetaMethod::invoke, member, converted argument", Iterations / 10, [&]
+    {
+        bench::do_not_optimize(scaleMethod->invoke(point, 2.0f, 3, tag));
+    });
+
+    constexpr std::size_t Methods = 300;
+    auto generated = rtti::global_define()._class<Generated>("Generated");
+    defineGenerated(generated, std::make_index_sequence<Methods>{});
+    generated._end();
+
+    auto *generatedClass = rtti::MetaClass::find(rtti::metaTypeId<Generated>());
+    bench::run("MetaContainer::getMethod(name), 300 methods", Iterations / 10, [&]
+    {
+        bench::do_not_optimize(generatedClass->getMethod("method299"));
+    });
+
+    bench::run("MetaContainer::getMethod(signature), 300 methods", Iterations / 10, [&]
+    {
+        bench::do_not_optimize(generatedClass->getMethod("method299(int)"));
+    });
+
+    auto const method299 = rtti::symbol{"method299"};
+    bench::run("MetaContainer::getMethod(symbol), 300 methods", Iterations / 10, [&]
+    {
+        bench::do_not_optimize(generatedClass->getMethod(method299));
+    });
+
+    rtti::global_define()
+        ._class<Level0>("Level0")
+            ._property("value", &Level0::value)
+        ._end()
+        ._class<Level1>("Level1")
+            ._base<Level0>()
+        ._end()
+        ._class<Level2>("Level2")
+            ._base<Level1>()
+        ._end()
+        ._class<Level3>("Level3")
+            ._base<Level2>()
+        ._end()
+    ;
+
+    auto *level3Class = rtti::MetaClass::find(rtti::metaTypeId<Level3>());
+    bench::run("MetaClass::getProperty, defined 3 levels up", Iterations, [&]
+    {
+        bench::do_not_optimize(level3Class->getProperty("value"));
+    });
+
+    auto const value = rtti::symbol{"value"};
+    bench::run("MetaClass::getProperty(symbol), 3 levels up", Iterations, [&]
+    {
+        bench::do_not_optimize(level3Class->getProperty(value));
+    });
+
+    Level3 level3;
+    Level3 *level3Ptr = &level3;
+    bench::run("meta_cast, up 3 levels", Iterations, [&]
+    {
+        bench::do_not_optimize(rtti::meta_cast<Level0>(level3Ptr));
+    });
+
+    rtti::global_define()
+        ._class<VirtualBase>("VirtualBase")
+        ._end()
+        ._class<VirtualDerived>("VirtualDerived")
+            ._base<VirtualBase>()
+        ._end()
+    ;
+
+    VirtualDerived virtualDerived;
+    VirtualBase *virtualBase = &virtualDerived;
+    bench::run("meta_cast, down from virtual base", Iterations, [&]
+    {
+        bench::do_not_optimize(rtti::meta_cast<VirtualDerived>(virtualBase));
+    });
+
+    VirtualDerived *virtualDerivedPtr = &virtualDerived;
+    bench::run("meta_cast, up to virtual base", Iterations, [&]
+    {
+        bench::do_not_optimize(rtti::meta_cast<VirtualBase>(virtualDerivedPtr));
+    });
+
+    rtti::variant level3Var = &level3;
+    bench::run("variant::is<Level0*>(), up 3 levels", Iterations, [&]
+    {
+        bench::do_not_optimize(level3Var.is<Level0*>());
+    });
+}
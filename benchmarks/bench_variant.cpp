@@ -0,0 +1,236 @@
+#include "bench.h"
+
+#include <rtti/algorithm.h>
+#include <rtti/variant.h>
+#include <rtti/variant_column.h>
+#include <rtti/variant_map.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+std::atomic<std::size_t> allocations = 0;
+
+using Payload = std::array<char, 256>;
+
+struct SharedPayload
+{
+    Payload data;
+};
+
+} // namespace
+
+namespace rtti {
+
+template<>
+struct variant_copy_on_write<SharedPayload>: std::true_type
+{};
+
+} // namespace rtti
+
+void* operator new(std::size_t size)
+{
+    ++allocations;
+    if (auto *result = std::malloc(size ? size : 1))
+        return result;
+    throw std::bad_alloc{};
+}
+
+void operator delete(void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+int main()
+{
+    constexpr std::size_t Iterations = 10'000'000;
+
+    rtti::variant number = 42;
+    bench::run("variant::ref<int>()", Iterations, [&]
+    {
+        bench::do_not_optimize(number.ref<int>());
+    });
+
+    bench::run("variant::cref<int>()", Iterations, [&]
+    {
+        bench::do_not_optimize(number.cref<int>());
+    });
+
+    char const *text = "text";
+    rtti::variant pointer = &text;
+    bench::run("variant::cref<char const * const *>()", Iterations, [&]
+    {
+        bench::do_not_optimize(pointer.cref<char const * const *>());
+    });
+
+    rtti::variant string = std::string{"text"};
+    auto before = allocations.load();
+    bench::run("variant copy, std::string", Iterations, [&]
+    {
+        rtti::variant copy = string;
+        bench::do_not_optimize(copy);
+    });
+    std::printf("%-48s %10.2f\n", "  heap allocations per copy",
+                double(allocations.load() - before) / double(Iterations + Iterations / 10));
+
+    rtti::variant payload = Payload{};
+    before = allocations.load();
+    bench::run("variant copy, 256 bytes", Iterations, [&]
+    {
+        rtti::variant copy = payload;
+        bench::do_not_optimize(copy);
+    });
+    std::printf("%-48s %10.2f\n", "  heap allocations per copy",
+                double(allocations.load() - before) / double(Iterations + Iterations / 10));
+
+    rtti::variant shared = SharedPayload{};
+    bench::run("variant copy, 256 bytes copy-on-write", Iterations, [&]
+    {
+        rtti::variant copy = shared;
+        bench::do_not_optimize(copy);
+    });
+
+    rtti::variant left = 1, right = 2.0;
+    bench::run("variant swap, int <-> double", Iterations, [&]
+    {
+        rtti::swap(left, right);
+        bench::do_not_optimize(left);
+    });
+
+    constexpr std::size_t Column = 1000;
+    std::vector<rtti::variant> column(Column, rtti::variant{42});
+    bench::run("std::vector<variant> reallocation", Iterations / Column, [&]
+    {
+        auto moved = std::vector<rtti::variant>{};
+        moved.reserve(Column);
+        for (auto &item: column)
+            moved.push_back(std::move(item));
+        column = std::move(moved);
+        bench::do_not_optimize(column.data());
+    }, Column);
+
+    bench::run("variant::try_to<int>(), failed", Iterations, [&]
+    {
+        bench::do_not_optimize(string.try_to<int>());
+    });
+
+    bench::run("variant::to<int>(), failed with exception", Iterations / 100, [&]
+    {
+        try
+        {
+            bench::do_not_optimize(string.to<int>());
+        }
+        catch (rtti::bad_variant_convert const&)
+        {}
+    });
+
+    constexpr std::size_t Keys = 10'000;
+    rtti::variant_map<std::size_t> map;
+    std::unordered_map<rtti::variant, std::size_t> unordered;
+    for (std::size_t i = 0; i < Keys; ++i)
+    {
+        map.try_emplace(std::to_string(i), i);
+        unordered.emplace(std::to_string(i), i);
+    }
+    std::vector<rtti::variant> keys;
+    for (std::size_t i = 0; i < Keys; ++i)
+        keys.emplace_back(std::to_string(i * 7 % Keys));
+
+    bench::run("variant_map::find(), std::string key", Iterations, [&, i = std::size_t{0}]() mutable
+    {
+        bench::do_not_optimize(map.find(keys[i++ % Keys]));
+    });
+
+    bench::run("std::unordered_map<variant>::find(), std::string key", Iterations, [&, i = std::size_t{0}]() mutable
+    {
+        bench::do_not_optimize(unordered.find(keys[i++ % Keys]));
+    });
+
+    constexpr std::size_t SortSize = 100'000;
+    std::vector<rtti::variant> unsorted;
+    for (std::size_t i = 0; i < SortSize; ++i)
+    {
+        auto value = (i * 2654435761u) % SortSize;
+        if (i % 2)
+            unsorted.emplace_back(static_cast<int>(value));
+        else
+            unsorted.emplace_back(static_cast<double>(value));
+    }
+    bench::run("std::sort of variants with operator<", 10, [&]
+    {
+        auto values = unsorted;
+        std::sort(values.begin(), values.end());
+        bench::do_not_optimize(values.data());
+    }, SortSize);
+
+    bench::run("rtti::sort of variants", 10, [&]
+    {
+        auto values = unsorted;
+        rtti::sort(values);
+        bench::do_not_optimize(values.data());
+    }, SortSize);
+
+    bench::run("rtti::sort(rtti::par) of variants", 10, [&]
+    {
+        auto values = unsorted;
+        rtti::sort(rtti::par, values);
+        bench::do_not_optimize(values.data());
+    }, SortSize);
+
+    std::vector<rtti::variant> single;
+    for (std::size_t i = 0; i < SortSize; ++i)
+        single.emplace_back(static_cast<double>((i * 2654435761u) % SortSize));
+    bench::run("rtti::sort of single type variants", 10, [&]
+    {
+        auto values = single;
+        rtti::sort(values);
+        bench::do_not_optimize(values.data());
+    }, SortSize);
+
+    bench::run("rtti::sort(rtti::par) of single type variants", 10, [&]
+    {
+        auto values = single;
+        rtti::sort(rtti::par, values);
+        bench::do_not_optimize(values.data());
+    }, SortSize);
+
+    auto ints = rtti::variant_column::create<int>();
+    std::vector<rtti::variant> intVariants;
+    for (std::size_t i = 0; i < Column; ++i)
+    {
+        ints.push_back(static_cast<int>(i));
+        intVariants.emplace_back(static_cast<int>(i));
+    }
+    bench::run("std::vector<variant> sum of int", Iterations / Column, [&]
+    {
+        auto sum = 0;
+        for (auto const &item: intVariants)
+            sum += item.cref<int>();
+        bench::do_not_optimize(sum);
+    }, Column);
+
+    bench::run("variant_column sum of int", Iterations / Column, [&]
+    {
+        auto sum = 0;
+        for (auto item: ints.values<int>())
+            sum += item;
+        bench::do_not_optimize(sum);
+    }, Column);
+
+    bench::run("variant::is<std::string const&>()", Iterations, [&]
+    {
+        bench::do_not_optimize(string.is<std::string const&>());
+    });
+}
@@ -0,0 +1,29 @@
+﻿#ifndef ALGORITHM_H
+#define ALGORITHM_H
+
+#include <rtti/variant.h>
+
+#include <vector>
+
+namespace rtti {
+
+// Sorts values in variant::operator< order. Values are grouped by type first,
+// then each homogeneous run is sorted with comparator of its type resolved once.
+// Runs of types without operator< keep their relative order.
+RTTI_API void sort(std::vector<variant> &values);
+
+// Execution policy tag, std::execution isn't used to avoid forcing TBB on users
+struct parallel_policy
+{
+    // Number of threads used, zero means hardware concurrency
+    unsigned threads = 0;
+};
+inline constexpr parallel_policy par{};
+
+// Homogeneous runs are sorted concurrently, long runs are sorted in chunks
+// by several threads and merged afterwards, so result is the same as of sort()
+RTTI_API void sort(parallel_policy, std::vector<variant> &values);
+
+} // namespace rtti
+
+#endif // ALGORITHM_H
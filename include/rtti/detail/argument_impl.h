@@ -4,24 +4,53 @@
 namespace rtti {
 
 template<typename T, typename>
-argument::argument(T &&value) noexcept
-    : m_rvalue(!std::is_reference_v<T>)
-    , m_value{std::ref(value)}
+variant_ref::variant_ref(T &&value) noexcept
+    : m_manager{internal::variant_function_table_for<std::reference_wrapper<std::remove_reference_t<T>>>()}
+    , m_data{const_cast<void*>(static_cast<void const*>(std::addressof(value)))}
+    , m_rvalue{!std::is_reference_v<T>}
 {}
 
+template<typename T>
+T* variant_ref::data() const noexcept
+{
+    using U = std::remove_cv_t<T>;
+    if (m_manager == internal::variant_function_table_for<std::reference_wrapper<U>>())
+        return static_cast<U*>(m_data);
+    if constexpr(std::is_const_v<T>)
+    {
+        if (m_manager == internal::variant_function_table_for<std::reference_wrapper<U const>>())
+            return static_cast<T*>(m_data);
+    }
+    return nullptr;
+}
+
+inline variant variant_ref::get() const noexcept
+{
+    variant result;
+    if (m_manager)
+    {
+        result.storage.ptr = m_data;
+        result.manager = m_manager;
+    }
+    return result;
+}
+
 // rvalue reference
 template<typename T>
 T argument::value(std::integral_constant<int, 0>) const
 {
-    using namespace std::literals;
     using Decay = std::decay_t<T>;
 
-    if (!m_rvalue)
+    if (!m_value.isRValue())
         throw bad_variant_cast{"Incompatible argument cast from LValue to RValue reference"};
 
-    auto *value = &m_value;
-    if (isVariant())
-        value = &m_value.ref<variant>();
+    if (auto *data = m_value.data<Decay>())
+        return std::move(*data);
+
+    m_view = m_value.get();
+    auto *value = &m_view;
+    if (m_value.data<variant const>())
+        value = &m_view.ref<variant>();
 
 #if defined (DEBUG)
     auto fromType = MetaType{value->typeId()};
@@ -31,8 +60,8 @@ T argument::value(std::integral_constant<int, 0>) const
     if (auto *data = value->data<Decay>())
         return std::move(*data);
 
-    m_dummy = value->to<Decay>();
-    auto *ptr = m_dummy.raw_data_ptr();
+    m_buffer = value->to<Decay>();
+    auto *ptr = m_buffer->raw_data_ptr();
     return std::move(*static_cast<Decay*>(const_cast<void*>(ptr)));
 }
 
@@ -42,9 +71,13 @@ T argument::value(std::integral_constant<int, 1>) const
 {
     using Decay = std::decay_t<T>;
 
-    auto const *value = &m_value;
-    if (isVariant())
-        value = &m_value.cref<variant>();
+    if (auto *data = m_value.data<Decay const>())
+        return *data;
+
+    m_view = m_value.get();
+    auto const *value = &m_view;
+    if (auto *inner = m_value.data<variant const>())
+        value = inner;
 
 #if defined (DEBUG)
     auto fromType = MetaType{value->typeId()};
@@ -53,8 +86,8 @@ T argument::value(std::integral_constant<int, 1>) const
     if (auto *data = value->data<Decay>())
         return *data;
 
-    m_dummy = value->to<Decay>();
-    auto *ptr = m_dummy.raw_data_ptr();
+    m_buffer = value->to<Decay>();
+    auto *ptr = m_buffer->raw_data_ptr();
     return *static_cast<Decay const*>(ptr);
 }
 
@@ -62,15 +95,18 @@ T argument::value(std::integral_constant<int, 1>) const
 template<typename T>
 T argument::value(std::integral_constant<int, 2>) const
 {
-    using namespace std::literals;
     using Decay = std::decay_t<T>;
 
-    if (m_rvalue)
+    if (m_value.isRValue())
         throw bad_variant_cast{"Incompatible argument cast from RValue to non cost LValue reference"};
 
-    auto *value = &m_value;
-    if (isVariant())
-        value = &m_value.ref<variant>();
+    if (auto *data = m_value.data<Decay>())
+        return *data;
+
+    m_view = m_value.get();
+    auto *value = &m_view;
+    if (m_value.data<variant const>())
+        value = &m_view.ref<variant>();
 
 #if defined (DEBUG)
     auto fromType = MetaType{value->typeId()};
@@ -84,12 +120,15 @@ T argument::value(std::integral_constant<int, 2>) const
 template<typename T>
 T argument::value(std::integral_constant<int, 3>) const
 {
-    using namespace std::literals;
     using Decay = std::decay_t<T>;
 
-    auto const *value = &m_value;
-    if (isVariant())
-        value = &m_value.cref<variant>();
+    if (auto *data = m_value.data<Decay const>())
+        return *data;
+
+    m_view = m_value.get();
+    auto const *value = &m_view;
+    if (auto *inner = m_value.data<variant const>())
+        value = inner;
 
 #if defined (DEBUG)
     auto fromType = MetaType{value->typeId()};
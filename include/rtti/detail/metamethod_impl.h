@@ -6,13 +6,87 @@ namespace rtti {
 template<typename ...Args>
 variant MetaMethod::invoke(Args&&... args) const
 {
-    static_assert(sizeof...(Args) <= IMethodInvoker::MaxNumberOfArguments,
-                  "Maximum supported metamethod arguments: 10");
     auto interface = invoker();
     if (interface->isStatic())
-        return interface->invoke_static(std::forward<Args>(args)...);
+    {
+        std::array<variant_ref, sizeof...(Args)> refs = {{std::forward<Args>(args)...}};
+        return interface->invoke_static(refs);
+    }
     else
-        return interface->invoke_method(std::forward<Args>(args)...);
+        return invoke_method(interface, std::forward<Args>(args)...);
+}
+
+template<typename I, typename ...Args>
+variant MetaMethod::invoke_method(IMethodInvoker const *interface, I &&instance, Args&&... args)
+{
+    std::array<variant_ref, sizeof...(Args)> refs = {{std::forward<Args>(args)...}};
+    return interface->invoke_method(std::forward<I>(instance), refs);
+}
+
+template<typename Signature>
+method_delegate<Signature> MetaMethod::bind() const
+{
+    auto result = method_delegate<Signature>::bind(*invoker());
+    if (!result)
+        throw invoke_error{"Incompatible delegate signature for method " + qualifiedName()};
+    return result;
+}
+
+template<typename R, typename ...Args>
+method_delegate<R(Args...)> method_delegate<R(Args...)>::bind(IMethodInvoker const &invoker)
+{
+    method_delegate result;
+    auto target = invoker.target();
+    if (!target.function || invoker.returnTypeId() != metaTypeId<R>())
+        return result;
+
+    auto params = invoker.parametersTypeId();
+    if (invoker.isStatic())
+    {
+        if (params == std::vector<MetaType_ID>{metaTypeId<Args>()...})
+            result.template assign<R (*)(Args...)>(target.function);
+    }
+    else if constexpr(sizeof...(Args) > 0)
+        result.template bind_method<Args...>(target, params);
+    return result;
+}
+
+template<typename R, typename ...Args>
+template<typename Self, typename ...Rest>
+void method_delegate<R(Args...)>::bind_method(method_target const &target,
+                                              std::vector<MetaType_ID> const &params) noexcept
+{
+    using C = std::remove_cv_t<std::remove_reference_t<Self>>;
+    if constexpr(std::is_lvalue_reference_v<Self> && std::is_class_v<C>)
+    {
+        if (target.classTypeId != metaTypeId<C>() ||
+            params != std::vector<MetaType_ID>{metaTypeId<Rest>()...})
+            return;
+
+        if (target.isConst)
+            assign<R (C::*)(Rest...) const>(target.function);
+        else if constexpr(!std::is_const_v<std::remove_reference_t<Self>>)
+            assign<R (C::*)(Rest...)>(target.function);
+    }
+}
+
+// Stored pointer may be noexcept qualified, it has the same representation
+template<typename R, typename ...Args>
+template<typename F>
+void method_delegate<R(Args...)>::assign(void const *function) noexcept
+{
+    static_assert(sizeof(F) <= sizeof(storage_t), "Function pointer doesn't fit delegate storage");
+    std::memcpy(&m_storage, function, sizeof(F));
+    m_thunk = &call<F>;
+}
+
+template<typename R, typename ...Args>
+template<typename F>
+R method_delegate<R(Args...)>::call(storage_t const &storage, Args&&... args)
+{
+    F func;
+    std::memcpy(&func, &storage, sizeof(F));
+    return std::invoke(func, std::forward<Args>(args)...);
 }
 
 } // namespace rtti
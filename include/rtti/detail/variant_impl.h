@@ -5,7 +5,7 @@ namespace rtti {
 
 namespace internal {
 
-template<typename T, bool Small = sizeof(T) <= STORAGE_SIZE>
+template<typename T, bool Small = (sizeof(T) <= STORAGE_SIZE) && (alignof(T) <= STORAGE_ALIGN)>
 using is_inplace = std::integral_constant<bool, Small>;
 
 template<typename T>
@@ -53,6 +53,8 @@ template<typename T>
 struct variant_function_table_impl<T, true, false>
 {
     using Decay = remove_all_cv_t<T>;
+    static constexpr bool TriviallyCopyable = std::is_trivially_copyable_v<Decay>;
+    static constexpr bool TriviallyRelocatable = TriviallyCopyable;
 
     static MetaType_ID type(type_attribute attr)
     {
@@ -119,6 +121,9 @@ private:
 template<typename T>
 struct variant_function_table_impl<T, true, true>
 {
+    static constexpr bool TriviallyCopyable = true;
+    static constexpr bool TriviallyRelocatable = true;
+
     static MetaType_ID type(type_attribute attr)
     {
         switch (attr) {
@@ -184,10 +189,62 @@ private:
     using Decay = std::conditional_t<std::is_array_v<U>, remove_all_cv_t<U>, full_decay_t<U>>;
 };
 
+// Out of line values are kept in the pool resource
+template<typename T>
+struct variant_heap
+{
+    static void* allocate()
+    {
+        return poolResource()->allocate(sizeof(T), alignof(T));
+    }
+
+    static void deallocate(void *ptr) noexcept
+    {
+        poolResource()->deallocate(ptr, sizeof(T), alignof(T));
+    }
+};
+
+// Copy-on-write value is preceded by reference counter in the same block
+template<typename T>
+struct variant_shared_heap
+{
+    using counter_t = std::atomic<std::size_t>;
+
+    static void* allocate()
+    {
+        auto *block = static_cast<char*>(poolResource()->allocate(Size, Align));
+        new (block) counter_t{1};
+        return block + Offset;
+    }
+
+    static void deallocate(void *ptr) noexcept
+    {
+        auto *block = static_cast<char*>(ptr) - Offset;
+        counter(ptr)->~counter_t();
+        poolResource()->deallocate(block, Size, Align);
+    }
+
+    static counter_t* counter(void const *ptr) noexcept
+    {
+        auto *block = const_cast<char*>(static_cast<char const*>(ptr)) - Offset;
+        return std::launder(reinterpret_cast<counter_t*>(block));
+    }
+
+private:
+    static constexpr std::size_t Offset = (sizeof(counter_t) + alignof(T) - 1) / alignof(T) * alignof(T);
+    static constexpr std::size_t Size   = Offset + sizeof(T);
+    static constexpr std::size_t Align  = std::max(alignof(T), alignof(counter_t));
+};
+
 template<typename T>
 struct variant_function_table_impl<T, false, false>
 {
     using Decay = remove_all_cv_t<T>;
+    static constexpr bool Shared = variant_copy_on_write<Decay>::value;
+    using Heap = std::conditional_t<Shared, variant_shared_heap<Decay>, variant_heap<Decay>>;
+    // Only pointer to heap value is kept in storage
+    static constexpr bool TriviallyCopyable = false;
+    static constexpr bool TriviallyRelocatable = true;
 
     static MetaType_ID type(type_attribute attr)
     {
@@ -213,22 +270,55 @@ struct variant_function_table_impl<T, false, false>
     static void copy_construct(void const *value, variant_type_storage &storage)
         noexcept(std::is_nothrow_copy_constructible_v<Decay>)
     {
-        storage.ptr = type_manager_t<Decay>::allocate();
-        type_manager_t<Decay>::copy_construct(value, storage.ptr);
+        auto *ptr = Heap::allocate();
+        if constexpr (std::is_nothrow_copy_constructible_v<Decay>)
+            type_manager_t<Decay>::copy_construct(value, ptr);
+        else
+        {
+            try
+            {
+                type_manager_t<Decay>::copy_construct(value, ptr);
+            }
+            catch (...)
+            {
+                Heap::deallocate(ptr);
+                throw;
+            }
+        }
+        storage.ptr = ptr;
     }
 
     static void move_construct(void *value, variant_type_storage &storage)
         noexcept(std::is_nothrow_move_constructible_v<Decay>)
     {
-        storage.ptr = type_manager_t<Decay>::allocate();
-        type_manager_t<Decay>::move_or_copy(value, storage.ptr);
+        auto *ptr = Heap::allocate();
+        if constexpr (std::is_nothrow_move_constructible_v<Decay>)
+            type_manager_t<Decay>::move_or_copy(value, ptr);
+        else
+        {
+            try
+            {
+                type_manager_t<Decay>::move_or_copy(value, ptr);
+            }
+            catch (...)
+            {
+                Heap::deallocate(ptr);
+                throw;
+            }
+        }
+        storage.ptr = ptr;
     }
 
     static void copy(variant_type_storage const &src, variant_type_storage &dst)
-        noexcept(std::is_nothrow_copy_constructible_v<Decay>)
+        noexcept(Shared || std::is_nothrow_copy_constructible_v<Decay>)
     {
-        dst.ptr = type_manager_t<Decay>::allocate();
-        type_manager_t<Decay>::copy_construct(src.ptr, dst.ptr);
+        if constexpr (Shared)
+        {
+            Heap::counter(src.ptr)->fetch_add(1, std::memory_order_relaxed);
+            dst.ptr = src.ptr;
+        }
+        else
+            copy_construct(src.ptr, dst);
     }
 
     static void move(variant_type_storage &src, variant_type_storage &dst) noexcept
@@ -238,8 +328,26 @@ struct variant_function_table_impl<T, false, false>
 
     static void destroy(variant_type_storage &value) noexcept
     {
+        if constexpr (Shared)
+        {
+            if (Heap::counter(value.ptr)->fetch_sub(1, std::memory_order_acq_rel) != 1)
+                return;
+        }
         type_manager_t<Decay>::destroy(value.ptr);
-        type_manager_t<Decay>::deallocate(value.ptr);
+        Heap::deallocate(value.ptr);
+    }
+
+    static void detach(variant_type_storage &value)
+    {
+        static_assert(std::is_copy_constructible_v<Decay>, "Copy-on-write type must be CopyConstructible");
+
+        if (Heap::counter(value.ptr)->load(std::memory_order_acquire) == 1)
+            return;
+
+        variant_type_storage unique;
+        copy_construct(value.ptr, unique);
+        destroy(value);
+        value.ptr = unique.ptr;
     }
 
     static bool compare_eq(variant_type_storage const &lhs, void const *rhs)
@@ -260,6 +368,9 @@ struct variant_function_table_impl<T[N], false, false>
 {
     using Decay = remove_all_cv_t<T[N]>;
     using Base = std::remove_all_extents_t<Decay>;
+    using Heap = variant_heap<Decay>;
+    static constexpr bool TriviallyCopyable = false;
+    static constexpr bool TriviallyRelocatable = true;
 
     static MetaType_ID type(type_attribute attr)
     {
@@ -285,22 +396,49 @@ struct variant_function_table_impl<T[N], false, false>
     static void copy_construct(void const *value, variant_type_storage &storage)
         noexcept(std::is_nothrow_copy_constructible_v<Base>)
     {
-        storage.ptr = type_manager_t<Decay>::allocate();
-        type_manager_t<Decay>::copy_construct(value, storage.ptr);
+        auto *ptr = Heap::allocate();
+        if constexpr (std::is_nothrow_copy_constructible_v<Base>)
+            type_manager_t<Decay>::copy_construct(value, ptr);
+        else
+        {
+            try
+            {
+                type_manager_t<Decay>::copy_construct(value, ptr);
+            }
+            catch (...)
+            {
+                Heap::deallocate(ptr);
+                throw;
+            }
+        }
+        storage.ptr = ptr;
     }
 
     static void move_construct(void *value, variant_type_storage &storage)
         noexcept(std::is_nothrow_move_constructible_v<Base>)
     {
-        storage.ptr = type_manager_t<Decay>::allocate();
-        type_manager_t<Decay>::move_or_copy(value, storage.ptr);
+        auto *ptr = Heap::allocate();
+        if constexpr (std::is_nothrow_move_constructible_v<Base>)
+            type_manager_t<Decay>::move_or_copy(value, ptr);
+        else
+        {
+            try
+            {
+                type_manager_t<Decay>::move_or_copy(value, ptr);
+            }
+            catch (...)
+            {
+                Heap::deallocate(ptr);
+                throw;
+            }
+        }
+        storage.ptr = ptr;
     }
 
     static void copy(variant_type_storage const &src, variant_type_storage &dst)
         noexcept(std::is_nothrow_copy_constructible_v<Base>)
     {
-        dst.ptr = type_manager_t<Decay>::allocate();
-        type_manager_t<Decay>::copy_construct(src.ptr, dst.ptr);
+        copy_construct(src.ptr, dst);
     }
 
     static void move(variant_type_storage &src, variant_type_storage &dst) noexcept
@@ -311,7 +449,7 @@ struct variant_function_table_impl<T[N], false, false>
     static void destroy(variant_type_storage &value) noexcept
     {
         type_manager_t<Decay>::destroy(value.ptr);
-        type_manager_t<Decay>::deallocate(value.ptr);
+        Heap::deallocate(value.ptr);
     }
 
     static bool compare_eq(variant_type_storage const &lhs, void const *rhs)
@@ -380,6 +518,41 @@ private:
     using C = std::remove_pointer_t<Decay>;
 };
 
+template<typename T>
+struct variant_hash
+{
+    static std::size_t hash(variant_type_storage const &value)
+    {
+        if constexpr (is_hashable_v<Decay>)
+        {
+            auto ptr = variant_function_table_impl<T>::access(value);
+            if constexpr (std::is_array_v<Decay>)
+                ptr = *reinterpret_cast<void const * const *>(ptr);
+            return type_function_table_impl<Decay>::hash(ptr);
+        }
+        else
+        {
+            static auto const result = std::hash<std::string_view>{}(type_name<Decay>());
+            return result;
+        }
+    }
+private:
+    using Decay = remove_all_cv_t<unwrap_reference_t<std::remove_cv_t<T>>>;
+};
+
+template<typename T>
+constexpr variant_function_table::detach_t variant_detach_for() noexcept
+{
+    using Impl = variant_function_table_impl<T>;
+    if constexpr (!is_inplace_v<std::remove_cv_t<T>> && !is_reference_wrapper_v<std::remove_cv_t<T>>
+                  && !std::is_array_v<T>)
+    {
+        if constexpr (Impl::Shared)
+            return &Impl::detach;
+    }
+    return nullptr;
+}
+
 template<typename T>
 inline variant_function_table const* variant_function_table_for() noexcept
 {
@@ -392,27 +565,18 @@ inline variant_function_table const* variant_function_table_for() noexcept
         &variant_function_table_impl<T>::move,
         &variant_function_table_impl<T>::destroy,
         &variant_function_table_impl<T>::compare_eq,
-        &class_info_get<T>::info
+        &variant_hash<T>::hash,
+        &class_info_get<T>::info,
+        variant_detach_for<T>(),
+        variant_function_table_impl<T>::TriviallyCopyable,
+        variant_function_table_impl<T>::TriviallyRelocatable
     };
     return &result;
 }
 
+// Empty variant is recognized by this table, so it must be unique across modules
 template<>
-inline variant_function_table const* variant_function_table_for<void>() noexcept
-{
-    static auto const result = variant_function_table{
-        [] (type_attribute) noexcept -> MetaType_ID { return MetaType_ID(); },
-        [] (variant_type_storage const&) noexcept -> void const* { return nullptr; },
-        [] (void const*, variant_type_storage&) noexcept {},
-        [] (void*, variant_type_storage&) noexcept {},
-        [] (variant_type_storage const&, variant_type_storage&) noexcept {},
-        [] (variant_type_storage&, variant_type_storage&) noexcept {},
-        [] (variant_type_storage&) noexcept {},
-        [] (variant_type_storage const&, void const*) noexcept -> bool { return false; },
-        [] (variant_type_storage const&) noexcept { return ClassInfo(); }
-    };
-    return &result;
-}
+RTTI_API variant_function_table const* variant_function_table_for<void>() noexcept;
 
 template<>
 inline variant_function_table const* variant_function_table_for<variant>() noexcept
@@ -426,16 +590,70 @@ inline variant_function_table const* variant_function_table_for<variant>() noexc
         [] (variant_type_storage&, variant_type_storage&) noexcept {},
         [] (variant_type_storage&) noexcept {},
         [] (variant_type_storage const&, void const*) noexcept -> bool { return false; },
-        [] (variant_type_storage const&) noexcept { return ClassInfo(); }
+        [] (variant_type_storage const&) noexcept -> std::size_t { return 0; },
+        [] (variant_type_storage const&) noexcept { return ClassInfo(); },
+        nullptr,
+        true,
+        true
     };
     return &result;
 }
 
 } // namespace internal
 
+inline variant::variant(variant const &other)
+    : manager{other.manager}
+{
+    if (manager->trivially_copyable)
+        storage = other.storage;
+    else
+        manager->f_copy(other.storage, storage);
+}
+
+inline variant::variant(variant &&other) noexcept
+    : manager{internal::variant_function_table_for<void>()}
+{
+    if (other.manager->trivially_relocatable)
+    {
+        manager = other.manager;
+        storage = other.storage;
+        other.manager = internal::variant_function_table_for<void>();
+    }
+    else
+        swap(other);
+}
+
+inline variant::~variant() noexcept
+{
+    if (!manager->trivially_copyable)
+        manager->f_destroy(storage);
+}
+
+template<typename T, bool Detach>
+T* variant::exact_ptr() const
+{
+    using Decay = std::remove_cv_t<T>;
+    if constexpr (std::is_array_v<Decay> || std::is_same_v<Decay, variant>
+                  || internal::is_reference_wrapper_v<Decay>)
+        return nullptr;
+    else
+    {
+        if (manager != internal::variant_function_table_for<Decay>())
+            return nullptr;
+
+        if constexpr (Detach && variant_copy_on_write<Decay>::value)
+            const_cast<variant*>(this)->detach();
+
+        if constexpr (internal::is_inplace_v<Decay>)
+            return const_cast<T*>(reinterpret_cast<Decay const*>(&storage.buffer));
+        else
+            return static_cast<T*>(storage.ptr);
+    }
+}
+
 template<typename T, typename>
 variant::variant(T &&value)
-    : manager{internal::variant_function_table_for<std::remove_reference_t<T>>()}
+    : manager{internal::variant_function_table_for<std::remove_cv_t<std::remove_reference_t<T>>>()}
 {
     using NoRef = std::remove_reference_t<T>;
     using Type = std::conditional_t<std::is_array_v<NoRef>, std::remove_all_extents_t<NoRef>, NoRef>;
@@ -498,20 +716,21 @@ bool variant::eq(T const &value) const
     return false;
 }
 
-template<typename ...Args>
-variant variant::invoke(std::string_view name, Args&& ...args)
+template<typename Self, typename Name, typename ...Args>
+variant variant::invoke_imp(Self &self, Name name, Args&& ...args)
 {
     using namespace std::literals;
 
-    auto type = MetaType{typeId()};
+    auto type = MetaType{self.typeId()};
     if (type.isClass() || type.isClassPtr())
     {
-        if (auto *mt_class = this->metaClass())
+        if (auto *mt_class = self.metaClass())
         {
-            if (auto mt_method = mt_class->getMethod(name))
-                return mt_method->invoke(*this, std::forward<Args>(args)...);
+            if (auto *mt_method = mt_class->getMethod(name))
+                return mt_method->invoke(self, std::forward<Args>(args)...);
 
-            throw runtime_error{"Method ["s + name + "] isn't found in class T = " + type.typeName()};
+            throw runtime_error{"Method ["s + std::string_view{name} + "] isn't found in class T = " +
+                                type.typeName()};
         }
         throw runtime_error{"Class T = "s + type.typeName() + " isn't registered"};
     }
@@ -519,28 +738,31 @@ variant variant::invoke(std::string_view name, Args&& ...args)
 }
 
 template<typename ...Args>
-variant variant::invoke(std::string_view name, Args&& ...args) const
+variant variant::invoke(std::string_view name, Args&& ...args)
 {
-    using namespace std::literals;
+    return invoke_imp(*this, name, std::forward<Args>(args)...);
+}
 
-    auto type = MetaType{typeId()};
-    if (type.isClass() || type.isClassPtr())
-    {
-        if (auto *mt_class = this->metaClass())
-        {
-            if (auto *mt_method = mt_class->getMethod(name))
-                return mt_method->invoke(*this, std::forward<Args>(args)...);
+template<typename ...Args>
+variant variant::invoke(std::string_view name, Args&& ...args) const
+{
+    return invoke_imp(*this, name, std::forward<Args>(args)...);
+}
 
-            throw runtime_error{"Method ["s + name + "] isn't found in class T = " + type.typeName()};
-        }
-        throw runtime_error{"Class T = "s + type.typeName() + " isn't registered"};
-    }
-    throw runtime_error{"Type T = "s + type.typeName() + " isn't Class or ClassPtr"};
+template<typename ...Args>
+variant variant::invoke(symbol name, Args&& ...args)
+{
+    return invoke_imp(*this, name, std::forward<Args>(args)...);
 }
 
+template<typename ...Args>
+variant variant::invoke(symbol name, Args&& ...args) const
+{
+    return invoke_imp(*this, name, std::forward<Args>(args)...);
+}
 
-template<typename T>
-void variant::set_property(std::string_view name, T &&value)
+template<typename Name, typename T>
+void variant::set_property_imp(Name name, T &&value)
 {
     using namespace std::literals;
 
@@ -552,30 +774,39 @@ void variant::set_property(std::string_view name, T &&value)
             if (auto *mt_property = mt_class->getProperty(name))
                 return mt_property->set(*this, std::forward<T>(value));
 
-            throw runtime_error{"Property ["s + name + "] isn't found in class T = " + type.typeName()};
+            throw runtime_error{"Property ["s + std::string_view{name} + "] isn't found in class T = " +
+                                type.typeName()};
         }
         throw runtime_error{"Class T = "s + type.typeName() + " isn't registered"};
     }
     throw runtime_error{"Type T = "s + type.typeName() + " isn't Class or ClassPtr"};
 }
 
+template<typename T>
+void variant::set_property(std::string_view name, T &&value)
+{
+    set_property_imp(name, std::forward<T>(value));
+}
+
+template<typename T>
+void variant::set_property(symbol name, T &&value)
+{
+    set_property_imp(name, std::forward<T>(value));
+}
+
 } // namespace rtti
 
 namespace std {
 
 template<>
-struct hash<rtti::variant>: public std::__hash_base<std::size_t, rtti::variant>
+struct hash<rtti::variant>
 {
-    std::size_t operator()(rtti::variant const &value) const noexcept
-    {
-        if (!value)
-            return 0;
+    using result_type = std::size_t;
+    using argument_type = rtti::variant;
 
-        auto type = rtti::MetaType{value.typeId()};
-        auto ptr = value.raw_data_ptr({});
-        if (type.isArray())
-            ptr = *reinterpret_cast<void const * const *>(ptr);
-        return _Hash_impl::hash(ptr, type.typeSize());
+    std::size_t operator()(rtti::variant const &value) const
+    {
+        return value.hash();
     }
 };
 
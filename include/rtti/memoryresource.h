@@ -0,0 +1,64 @@
+﻿#ifndef MEMORYRESOURCE_H
+#define MEMORYRESOURCE_H
+
+#include <rtti/export.h>
+
+#include <cstddef>
+
+namespace rtti {
+
+class RTTI_API MemoryResource
+{
+public:
+    MemoryResource() = default;
+    MemoryResource(MemoryResource const&) = delete;
+    MemoryResource& operator=(MemoryResource const&) = delete;
+    virtual ~MemoryResource() = default;
+
+    void* allocate(std::size_t size, std::size_t align)
+    { return do_allocate(size, align); }
+
+    void deallocate(void *ptr, std::size_t size, std::size_t align) noexcept
+    { do_deallocate(ptr, size, align); }
+
+protected:
+    virtual void* do_allocate(std::size_t size, std::size_t align) = 0;
+    virtual void do_deallocate(void *ptr, std::size_t size, std::size_t align) noexcept = 0;
+};
+
+// Global operator new/delete
+RTTI_API MemoryResource* newDeleteResource() noexcept;
+
+// Free lists by size class, cached per thread. Blocks freed by another thread
+// are handed back to the owner and reused on its next allocation. Memory is kept
+// for reuse and isn't returned to upstream until process exit.
+RTTI_API MemoryResource* poolResource() noexcept;
+
+// Bump allocator for request scoped objects. Deallocation is no-op,
+// memory is released all at once by release() or destructor.
+class RTTI_API ArenaResource final: public MemoryResource
+{
+public:
+    explicit ArenaResource(std::size_t blockSize = 4096,
+                           MemoryResource *upstream = newDeleteResource()) noexcept;
+    ~ArenaResource() override;
+
+    void release() noexcept;
+
+protected:
+    void* do_allocate(std::size_t size, std::size_t align) override;
+    void do_deallocate(void *ptr, std::size_t size, std::size_t align) noexcept override;
+
+private:
+    struct Block;
+
+    MemoryResource *m_upstream;
+    std::size_t m_blockSize;
+    Block *m_blocks = nullptr;
+    char *m_current = nullptr;
+    char *m_end = nullptr;
+};
+
+} // namespace rtti
+
+#endif // MEMORYRESOURCE_H
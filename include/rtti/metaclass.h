@@ -7,6 +7,8 @@
 
 #include <rtti/sfinae.h>
 
+#include <atomic>
+
 namespace rtti {
 
 namespace internal {
@@ -31,17 +33,23 @@ public:
     std::size_t derivedClassCount() const;
     MetaClass const* derivedClass(std::size_t index) const;
     bool inheritedFrom(MetaClass const *base) const;
+    // Changed whenever member or base class is added to class or to any of its bases
+    std::size_t definitionGeneration() const noexcept;
+    // Counter behind definitionGeneration(), can be cached and read inline
+    std::atomic_size_t const& definitionCounter() const noexcept;
 protected:
     RTTI_PRIVATE explicit MetaClass(std::string_view name, MetaContainer const &owner, MetaType_ID typeId);
     static MetaClass* create(std::string_view name, MetaContainer &owner, MetaType_ID typeId);
 
-    void addBaseClass(MetaType_ID typeId, cast_func_t caster);
+    void addBaseClass(MetaType_ID typeId, cast_func_t caster, bool isVirtual);
     RTTI_PRIVATE void addDerivedClass(MetaType_ID typeId);
     void const* cast(MetaClass const *base, void const *instance) const;
     void* cast(MetaClass const *base, void *instance) const;
 
     RTTI_PRIVATE MetaMethod const* getMethodInternal(std::string_view name) const override;
     RTTI_PRIVATE MetaProperty const* getPropertyInternal(std::string_view name) const override;
+    RTTI_PRIVATE MetaMethod const* getMethodInternal(symbol name) const override;
+    RTTI_PRIVATE MetaProperty const* getPropertyInternal(symbol name) const override;
 
 private:
     DECLARE_ACCESS_KEY(CreateAccessKey)
@@ -57,8 +65,8 @@ private:
 public:
     static MetaClass* create(std::string_view name, MetaContainer &owner, MetaType_ID typeId, CreateAccessKey)
     { return create(name, owner, typeId); }
-    void addBaseClass(MetaType_ID typeId, cast_func_t caster, CreateAccessKey)
-    { addBaseClass(typeId, caster); }
+    void addBaseClass(MetaType_ID typeId, cast_func_t caster, bool isVirtual, CreateAccessKey)
+    { addBaseClass(typeId, caster, isVirtual); }
 
     void const* cast(MetaClass const *base, void const *instance, CastAccessKey) const
     { return cast(base, instance); }
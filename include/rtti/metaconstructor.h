@@ -19,11 +19,12 @@ public:
     template<typename ...Args>
     variant invoke(Args&&... args) const
     {
-        static_assert(sizeof...(Args) <= IConstructorInvoker::MaxNumberOfArguments,
-                      "Maximum supported metaconstructor arguments: 10");
-        return constructor()->invoke_static(std::forward<Args>(args)...);
+        std::array<variant_ref, sizeof...(Args)> refs = {{std::forward<Args>(args)...}};
+        return constructor()->invoke_static(refs);
     }
 
+    variant invokeArgs(span<variant_ref const> args, void *result = nullptr) const;
+
 protected:
     explicit MetaConstructor(std::string_view name, MetaContainer &owner,
                              std::unique_ptr<IConstructorInvoker> constructor);
@@ -44,10 +44,12 @@ public:
     using enum_method_t = std::function<bool(MetaMethod const*)>;
 
     MetaNamespace const* getNamespace(std::string_view name) const;
+    MetaNamespace const* getNamespace(symbol name) const;
     std::size_t namespaceCount() const;
     MetaNamespace const* getNamespace(std::size_t index) const;
 
     MetaClass const* getClass(std::string_view name) const;
+    MetaClass const* getClass(symbol name) const;
     std::size_t classCount() const;
     MetaClass const* getClass(std::size_t index) const;
     void for_each_class(enum_class_t const &func) const;
@@ -64,6 +66,7 @@ public:
     MetaConstructor const* moveConstructor() const;
 
     MetaMethod const* getMethod(std::string_view name) const;
+    MetaMethod const* getMethod(symbol name) const;
 
     template<typename ...Args>
     MetaMethod const* getMethod(std::string_view name) const
@@ -74,10 +77,12 @@ public:
     void for_each_method(enum_method_t const &func) const;
 
     MetaProperty const* getProperty(std::string_view name) const;
+    MetaProperty const* getProperty(symbol name) const;
     std::size_t propertyCount() const;
     MetaProperty const* getProperty(std::size_t index) const;
 
     MetaEnum const* getEnum(std::string_view name) const;
+    MetaEnum const* getEnum(symbol name) const;
     std::size_t enumCount() const;
     MetaEnum const* getEnum(std::size_t index) const;
 
@@ -90,12 +95,15 @@ protected:
     RTTI_PRIVATE std::size_t count(MetaCategory category) const;
     RTTI_PRIVATE MetaItem const* item(MetaCategory category, std::size_t index) const;
     RTTI_PRIVATE MetaItem const* item(MetaCategory category, std::string_view name) const;
+    RTTI_PRIVATE MetaItem const* item(MetaCategory category, symbol name) const;
 
     void setDeferredDefine(std::unique_ptr<IDefinitionCallbackHolder> callback);
     RTTI_PRIVATE void checkDeferredDefine() const override;
 
     RTTI_PRIVATE virtual MetaMethod const* getMethodInternal(std::string_view name) const;
     RTTI_PRIVATE virtual MetaProperty const* getPropertyInternal(std::string_view name) const;
+    RTTI_PRIVATE virtual MetaMethod const* getMethodInternal(symbol name) const;
+    RTTI_PRIVATE virtual MetaProperty const* getPropertyInternal(symbol name) const;
 
 private:
     DECLARE_ACCESS_KEY(DeferredDefineKey)
@@ -31,6 +31,18 @@ static void const * metacast_to_base(void const *value)
                 static_cast<DerivedType const *>(value)));
 }
 
+// Downcast with static_cast is ill-formed only for virtual base,
+// since non-accessible or ambiguous base can't be registered anyway
+template<typename DerivedType, typename BaseType, typename = void>
+struct is_virtual_base_of: std::true_type
+{};
+
+template<typename DerivedType, typename BaseType>
+struct is_virtual_base_of<DerivedType, BaseType,
+                          std::void_t<decltype(static_cast<DerivedType const *>(std::declval<BaseType const *>()))>>
+    : std::false_type
+{};
+
 template<typename T, typename F>
 struct DefinitionCallbackHolder: IDefinitionCallbackHolder
 {
@@ -75,30 +87,33 @@ std::conditional_t<std::is_void_v<typename mpl::function_traits<F>::result_type>
 
 template<typename F, typename Tag> struct method_invoker;
 
-using argument_array_t = std::array<argument const*, IMethodInvoker::MaxNumberOfArguments>;
+using argument_span_t = span<variant_ref const>;
 
-inline argument_array_t pack_arguments(std::size_t count,
-                          argument const &arg0, argument const &arg1,
-                          argument const &arg2, argument const &arg3,
-                          argument const &arg4, argument const &arg5,
-                          argument const &arg6, argument const &arg7,
-                          argument const &arg8, argument const &arg9)
+inline void check_arguments(std::size_t count, argument_span_t args)
 {
-    argument_array_t result = {{
-        &arg0, &arg1, &arg2, &arg3, &arg4,
-        &arg5, &arg6, &arg7, &arg8, &arg9}};
+    if (args.size() != count)
+        throw invoke_error{"Invalid number of arguments"};
+}
 
-    for (auto const &item: result)
+// Result is constructed in caller provided buffer when it isn't null,
+// reference result is stored there as pointer
+template<typename R, typename ...Args>
+variant invoke_result(void *buffer, Args&&... args)
+{
+    if constexpr(std::is_reference_v<R>)
     {
-        if (item->empty())
-            break;
-        --count;
+        R result = std::invoke(std::forward<Args>(args)...);
+        if (!buffer)
+            return std::ref(result);
+        new (buffer) std::remove_reference_t<R>*{std::addressof(result)};
     }
-
-    if (count != 0)
-        throw invoke_error{"Invalid number of arguments"};
-
-    return result;
+    else
+    {
+        if (!buffer)
+            return std::invoke(std::forward<Args>(args)...);
+        new (buffer) R(std::invoke(std::forward<Args>(args)...));
+    }
+    return variant::empty_variant;
 }
 
 template<typename F>
@@ -106,9 +121,6 @@ struct method_invoker<F, void_static_func>
 {
     using Args = typename mpl::function_traits<F>::args;
 
-    static_assert(mpl::typelist_size_v<Args> <= IMethodInvoker::MaxNumberOfArguments,
-                  "Maximum supported arguments: 10");
-
     static bool isStatic()
     { return true; }
     static MetaType_ID returnTypeId()
@@ -118,25 +130,13 @@ struct method_invoker<F, void_static_func>
     static std::string signature(std::string_view name)
     { return f_signature<F>::get(name); }
 
-    static variant invoke(F func,
-                          argument const &arg0, argument const &arg1,
-                          argument const &arg2, argument const &arg3,
-                          argument const &arg4, argument const &arg5,
-                          argument const &arg6, argument const &arg7,
-                          argument const &arg8, argument const &arg9)
+    static variant invoke(F func, argument_span_t args, void*)
     {
-        auto const &args = pack_arguments(mpl::typelist_size_v<Args>,
-                                          arg0, arg1, arg2, arg3, arg4,
-                                          arg5, arg6, arg7, arg8, arg9);
+        check_arguments(mpl::typelist_size_v<Args>, args);
         return invoke_imp(func, args, argument_indexes_t{});
     }
 
-    static variant invoke(F, variant const&,
-                          argument const&, argument const&,
-                          argument const&, argument const&,
-                          argument const&, argument const&,
-                          argument const&, argument const&,
-                          argument const&, argument const&)
+    static variant invoke(F, variant const&, argument_span_t, void*)
     { assert(false); return variant::empty_variant; }
 private:
     template<std::size_t I>
@@ -150,9 +150,9 @@ private:
     }
 
     template<std::size_t ...I>
-    static variant invoke_imp(F func, argument_array_t const &args, mpl::index_sequence<I...>)
+    static variant invoke_imp(F func, [[maybe_unused]] argument_span_t args, mpl::index_sequence<I...>)
     {
-        func(args[I]->value<argument_get_t<I>>()...);
+        func(argument{args[I]}.value<argument_get_t<I>>()...);
         return variant::empty_variant;
     }
 };
@@ -163,9 +163,6 @@ struct method_invoker<F, return_static_func>
     using Args = typename mpl::function_traits<F>::args;
     using Result = typename mpl::function_traits<F>::result_type;
 
-    static_assert(mpl::typelist_size_v<Args> <= IMethodInvoker::MaxNumberOfArguments,
-                  "Maximum supported arguments: 10");
-
     static bool isStatic()
     { return true; }
 
@@ -178,25 +175,13 @@ struct method_invoker<F, return_static_func>
     static std::string signature(std::string_view name)
     { return f_signature<F>::get(name); }
 
-    static variant invoke(F func,
-                          argument const &arg0, argument const &arg1,
-                          argument const &arg2, argument const &arg3,
-                          argument const &arg4, argument const &arg5,
-                          argument const &arg6, argument const &arg7,
-                          argument const &arg8, argument const &arg9)
+    static variant invoke(F func, argument_span_t args, void *result)
     {
-        auto const &args = pack_arguments(mpl::typelist_size_v<Args>,
-                                          arg0, arg1, arg2, arg3, arg4,
-                                          arg5, arg6, arg7, arg8, arg9);
-        return invoke(func, args, argument_indexes_t{});
+        check_arguments(mpl::typelist_size_v<Args>, args);
+        return invoke_imp(func, args, result, argument_indexes_t{});
     }
 
-    static variant invoke(F, const variant&,
-                          argument const&, argument const&,
-                          argument const&, argument const&,
-                          argument const&, argument const&,
-                          argument const&, argument const&,
-                          argument const&, argument const&)
+    static variant invoke(F, const variant&, argument_span_t, void*)
     { assert(false); return variant::empty_variant; }
 private:
     template<std::size_t I>
@@ -210,12 +195,10 @@ private:
     }
 
     template<std::size_t ...I>
-    static variant invoke(F func, argument_array_t const &args, mpl::index_sequence<I...>)
+    static variant invoke_imp(F func, [[maybe_unused]] argument_span_t args, void *result,
+                              mpl::index_sequence<I...>)
     {
-        if constexpr(std::is_reference_v<Result>)
-            return std::ref(func(args[I]->value<argument_get_t<I>>()...));
-        else
-            return func(args[I]->value<argument_get_t<I>>()...);
+        return invoke_result<Result>(result, func, argument{args[I]}.value<argument_get_t<I>>()...);
     }
 };
 
@@ -224,9 +207,6 @@ struct method_invoker<F, void_member_func>
 {
     using Args = typename mpl::function_traits<F>::args;
 
-    static_assert(mpl::typelist_size_v<Args> <= IMethodInvoker::MaxNumberOfArguments,
-                  "Maximum supported arguments: 10");
-
     static bool isStatic()
     { return false; }
     static MetaType_ID returnTypeId()
@@ -236,40 +216,19 @@ struct method_invoker<F, void_member_func>
     static std::string signature(std::string_view name)
     { return f_signature<F>::get(name); }
 
-    static variant invoke(F func,
-                          variant const &instance,
-                          argument const &arg0, argument const &arg1,
-                          argument const &arg2, argument const &arg3,
-                          argument const &arg4, argument const &arg5,
-                          argument const &arg6, argument const &arg7,
-                          argument const &arg8, argument const &arg9)
+    static variant invoke(F func, variant const &instance, argument_span_t args, void*)
     {
-        auto const &args = pack_arguments(mpl::typelist_size_v<Args>,
-                                          arg0, arg1, arg2, arg3, arg4,
-                                          arg5, arg6, arg7, arg8, arg9);
+        check_arguments(mpl::typelist_size_v<Args>, args);
         return invoke_imp(func, instance, args, argument_indexes_t{});
     }
 
-    static variant invoke(F func,
-                          variant &instance,
-                          argument const &arg0, argument const &arg1,
-                          argument const &arg2, argument const &arg3,
-                          argument const &arg4, argument const &arg5,
-                          argument const &arg6, argument const &arg7,
-                          argument const &arg8, argument const &arg9)
+    static variant invoke(F func, variant &instance, argument_span_t args, void*)
     {
-        auto const &args = pack_arguments(mpl::typelist_size_v<Args>,
-                                          arg0, arg1, arg2, arg3, arg4,
-                                          arg5, arg6, arg7, arg8, arg9);
+        check_arguments(mpl::typelist_size_v<Args>, args);
         return invoke_imp(func, instance, args, argument_indexes_t{});
     }
 
-    static variant invoke(F,
-                          argument const&, argument const&,
-                          argument const&, argument const&,
-                          argument const&, argument const&,
-                          argument const&, argument const&,
-                          argument const&, argument const&)
+    static variant invoke(F, argument_span_t, void*)
     { assert(false); return variant::empty_variant; }
 private:
     template<std::size_t I>
@@ -290,33 +249,33 @@ private:
 
     template<std::size_t ...I>
     static variant invoke_imp(F func, variant const &instance,
-                              argument_array_t const &args, mpl::index_sequence<I...>)
+                              [[maybe_unused]] argument_span_t args, mpl::index_sequence<I...>)
     {
         using namespace std::literals;
         auto type = MetaType{instance.typeId()};
         if (type.isClass())
         {
             if constexpr(is_const_method::value)
-                (instance.ref<class_t>().*func)(args[I]->value<argument_get_t<I>>()...);
+                (instance.ref<class_t>().*func)(argument{args[I]}.value<argument_get_t<I>>()...);
             else
                 throw bad_variant_cast{"Incompatible types: const rtti::variant& -> "s +
                                        type_name<class_ref_t>()};
         }
         else if (type.isClassPtr())
-            (instance.to<class_ptr_t>()->*func)(args[I]->value<argument_get_t<I>>()...);
+            (instance.to<class_ptr_t>()->*func)(argument{args[I]}.value<argument_get_t<I>>()...);
 
         return variant::empty_variant;
     }
 
     template<std::size_t ...I>
     static variant invoke_imp(F func, variant &instance,
-                              argument_array_t const &args, mpl::index_sequence<I...>)
+                              [[maybe_unused]] argument_span_t args, mpl::index_sequence<I...>)
     {
         auto type = MetaType{instance.typeId()};
         if (type.isClass())
-            (instance.ref<class_t>().*func)(args[I]->value<argument_get_t<I>>()...);
+            (instance.ref<class_t>().*func)(argument{args[I]}.value<argument_get_t<I>>()...);
         else if (type.isClassPtr())
-            (instance.to<class_ptr_t>()->*func)(args[I]->value<argument_get_t<I>>()...);
+            (instance.to<class_ptr_t>()->*func)(argument{args[I]}.value<argument_get_t<I>>()...);
 
         return variant::empty_variant;
     }
@@ -328,9 +287,6 @@ struct method_invoker<F, return_member_func>
     using Args = typename mpl::function_traits<F>::args;
     using Result = typename mpl::function_traits<F>::result_type;
 
-    static_assert(mpl::typelist_size_v<Args> <= IMethodInvoker::MaxNumberOfArguments,
-                  "Maximum supported arguments: 10");
-
     static bool isStatic()
     { return false; }
     static MetaType_ID returnTypeId()
@@ -340,40 +296,19 @@ struct method_invoker<F, return_member_func>
     static std::string signature(std::string_view name)
     { return f_signature<F>::get(name); }
 
-    static variant invoke(F func,
-                          variant const &instance,
-                          argument const &arg0, argument const &arg1,
-                          argument const &arg2, argument const &arg3,
-                          argument const &arg4, argument const &arg5,
-                          argument const &arg6, argument const &arg7,
-                          argument const &arg8, argument const &arg9)
+    static variant invoke(F func, variant const &instance, argument_span_t args, void *result)
     {
-        auto const &args = pack_arguments(mpl::typelist_size_v<Args>,
-                                          arg0, arg1, arg2, arg3, arg4,
-                                          arg5, arg6, arg7, arg8, arg9);
-        return invoke_imp(func, instance, args, argument_indexes_t{});
+        check_arguments(mpl::typelist_size_v<Args>, args);
+        return invoke_imp(func, instance, args, result, argument_indexes_t{});
     }
 
-    static variant invoke(F func,
-                          variant &instance,
-                          argument const &arg0, argument const &arg1,
-                          argument const &arg2, argument const &arg3,
-                          argument const &arg4, argument const &arg5,
-                          argument const &arg6, argument const &arg7,
-                          argument const &arg8, argument const &arg9)
+    static variant invoke(F func, variant &instance, argument_span_t args, void *result)
     {
-        auto const &args = pack_arguments(mpl::typelist_size_v<Args>,
-                                          arg0, arg1, arg2, arg3, arg4,
-                                          arg5, arg6, arg7, arg8, arg9);
-        return invoke_imp(func, instance, args, argument_indexes_t{});
+        check_arguments(mpl::typelist_size_v<Args>, args);
+        return invoke_imp(func, instance, args, result, argument_indexes_t{});
     }
 
-    static variant invoke(F,
-                          argument const&, argument const&,
-                          argument const&, argument const&,
-                          argument const&, argument const&,
-                          argument const&, argument const&,
-                          argument const&, argument const&)
+    static variant invoke(F, argument_span_t, void*)
     { assert(false); return variant::empty_variant; }
 private:
     template<std::size_t I>
@@ -392,44 +327,39 @@ private:
         return { metaTypeId<argument_get_t<I>>()... };
     }
 
-    template<typename R>
-    static variant reference_get(R &&result)
-    {
-        if constexpr(std::is_reference_v<Result>)
-            return std::ref(std::forward<R>(result));
-        else
-            return std::forward<R>(result);
-    }
-
     template<std::size_t ...I>
-    static variant invoke_imp(F func, variant const &instance, argument_array_t const &args,
-                              mpl::index_sequence<I...>)
+    static variant invoke_imp(F func, variant const &instance, [[maybe_unused]] argument_span_t args,
+                              void *result, mpl::index_sequence<I...>)
     {
         using namespace std::literals;
         auto type = MetaType{instance.typeId()};
         if (type.isClass())
         {
             if constexpr(is_const_method::value)
-                return reference_get((instance.ref<class_t>().*func)(args[I]->value<argument_get_t<I>>()...));
+                return invoke_result<Result>(result, func, instance.ref<class_t>(),
+                                             argument{args[I]}.value<argument_get_t<I>>()...);
             else
                 throw bad_variant_cast{"Incompatible types: const rtti::variant& -> "s +
                                        type_name<class_ref_t>()};
         }
         else if (type.isClassPtr())
-            return reference_get((instance.to<class_ptr_t>()->*func)(args[I]->value<argument_get_t<I>>()...));
+            return invoke_result<Result>(result, func, instance.to<class_ptr_t>(),
+                                         argument{args[I]}.value<argument_get_t<I>>()...);
 
         return variant::empty_variant;
     }
 
     template<std::size_t ...I>
-    static variant invoke_imp(F func, variant &instance, argument_array_t const &args,
-                              mpl::index_sequence<I...>)
+    static variant invoke_imp(F func, variant &instance, [[maybe_unused]] argument_span_t args,
+                              void *result, mpl::index_sequence<I...>)
     {
         auto type = MetaType{instance.typeId()};
         if (type.isClass())
-            return reference_get((instance.ref<class_t>().*func)(args[I]->value<argument_get_t<I>>()...));
+            return invoke_result<Result>(result, func, instance.ref<class_t>(),
+                                         argument{args[I]}.value<argument_get_t<I>>()...);
         else if (type.isClassPtr())
-            return reference_get((instance.to<class_ptr_t>()->*func)(args[I]->value<argument_get_t<I>>()...));
+            return invoke_result<Result>(result, func, instance.to<class_ptr_t>(),
+                                         argument{args[I]}.value<argument_get_t<I>>()...);
 
         return variant::empty_variant;
     }
@@ -459,39 +389,25 @@ struct MethodInvoker: IMethodInvoker
     std::string signature(std::string_view name) const override
     { return invoker_t::signature(name); }
 
-    variant invoke_static(argument arg0 = argument{}, argument arg1 = argument{},
-                          argument arg2 = argument{}, argument arg3 = argument{},
-                          argument arg4 = argument{}, argument arg5 = argument{},
-                          argument arg6 = argument{}, argument arg7 = argument{},
-                          argument arg8 = argument{}, argument arg9 = argument{}) const override
-    {
-        return invoker_t::invoke(m_func,
-                                         arg0, arg1, arg2, arg3, arg4,
-                                         arg5, arg6, arg7, arg8, arg9);
-    }
+    variant invoke_static(argument_span_t args, void *result = nullptr) const override
+    { return invoker_t::invoke(m_func, args, result); }
 
-    variant invoke_method(variant const &instance,
-                          argument arg0 = argument{}, argument arg1 = argument{},
-                          argument arg2 = argument{}, argument arg3 = argument{},
-                          argument arg4 = argument{}, argument arg5 = argument{},
-                          argument arg6 = argument{}, argument arg7 = argument{},
-                          argument arg8 = argument{}, argument arg9 = argument{}) const override
-    {
-        return invoker_t::invoke(m_func, instance,
-                                         arg0, arg1, arg2, arg3, arg4,
-                                         arg5, arg6, arg7, arg8, arg9);
-    }
+    variant invoke_method(variant const &instance, argument_span_t args,
+                          void *result = nullptr) const override
+    { return invoker_t::invoke(m_func, instance, args, result); }
 
-    variant invoke_method(variant &instance,
-                          argument arg0 = argument{}, argument arg1 = argument{},
-                          argument arg2 = argument{}, argument arg3 = argument{},
-                          argument arg4 = argument{}, argument arg5 = argument{},
-                          argument arg6 = argument{}, argument arg7 = argument{},
-                          argument arg8 = argument{}, argument arg9 = argument{}) const override
+    variant invoke_method(variant &instance, argument_span_t args,
+                          void *result = nullptr) const override
+    { return invoker_t::invoke(m_func, instance, args, result); }
+
+    method_target target() const override
     {
-        return invoker_t::invoke(m_func, instance,
-                                         arg0, arg1, arg2, arg3, arg4,
-                                         arg5, arg6, arg7, arg8, arg9);
+        using traits = mpl::function_traits<F>;
+        if constexpr((std::is_pointer_v<F> || std::is_member_function_pointer_v<F>) &&
+                     !traits::is_lrefthis::value && !traits::is_rrefthis::value)
+            return {&m_func, metaTypeId<typename traits::class_type>(), traits::is_const::value};
+        else
+            return {};
     }
 private:
     F const m_func;
@@ -506,7 +422,6 @@ inline auto make_method_invoker(F &&func)
 template<typename C, typename ...Args>
 struct ConstructorInvoker: IConstructorInvoker
 {
-    static_assert(sizeof...(Args) <= MaxNumberOfArguments, "Maximum supported arguments: 10");
     static_assert((sizeof...(Args) > 0) || std::is_default_constructible_v<C>,
                   "Type is not default constructible");
     static_assert((sizeof...(Args) == 0) || std::is_constructible_v<C, Args...>,
@@ -537,27 +452,20 @@ struct ConstructorInvoker: IConstructorInvoker
         return signature(name, args_size_t{});
     }
 
-    variant invoke_static(argument arg0 = argument{}, argument arg1 = argument{},
-                          argument arg2 = argument{}, argument arg3 = argument{},
-                          argument arg4 = argument{}, argument arg5 = argument{},
-                          argument arg6 = argument{}, argument arg7 = argument{},
-                          argument arg8 = argument{}, argument arg9 = argument{}) const override
+    variant invoke_static(argument_span_t args, void *result = nullptr) const override
     {
-        auto const &args = pack_arguments(sizeof...(Args),
-                                          arg0, arg1, arg2, arg3, arg4,
-                                          arg5, arg6, arg7, arg8, arg9);
-        return invoke(args, argument_indexes_t{});
+        check_arguments(sizeof...(Args), args);
+        return invoke(args, result, argument_indexes_t{});
     }
 
-    variant invoke_method(variant const&,
-                          argument, argument, argument, argument, argument,
-                          argument, argument, argument, argument, argument) const override
+    variant invoke_method(variant const&, argument_span_t, void* = nullptr) const override
     { assert(false); return variant::empty_variant; }
 
-    variant invoke_method(variant&,
-                          argument, argument, argument, argument, argument,
-                          argument, argument, argument, argument, argument) const override
+    variant invoke_method(variant&, argument_span_t, void* = nullptr) const override
     { assert(false); return variant::empty_variant; }
+
+    method_target target() const override
+    { return {}; }
 private:
     static constexpr char const* signature(std::string_view,
                                            std::integral_constant<int, 0>)
@@ -588,10 +496,13 @@ private:
     }
 
     template<std::size_t ...I>
-    static variant invoke(argument_array_t const &args,
+    static variant invoke([[maybe_unused]] argument_span_t args, void *result,
                           mpl::index_sequence<I...>)
     {
-        return C(args[I]->value<argument_get_t<I>>()...);
+        if (!result)
+            return C(argument{args[I]}.value<argument_get_t<I>>()...);
+        new (result) C(argument{args[I]}.value<argument_get_t<I>>()...);
+        return variant::empty_variant;
     }
 };
 
@@ -649,21 +560,21 @@ struct property_invoker<P, static_pointer>
     static variant get_static(P property)
     { return std::cref(*property); }
 
-    static void set_static([[maybe_unused]] P property, argument const &arg)
+    static void set_static([[maybe_unused]] P property, variant_ref arg)
     {
         if constexpr(std::is_const_v<T>)
             throw invoke_error{"Write to readonly property"};
         else
-            *property = arg.value<T>();
+            *property = argument{arg}.value<T>();
     }
 
     static variant get_field(P, variant const&)
     { assert(false); return variant::empty_variant; }
 
-    static void set_field(P, variant const&, argument const&)
+    static void set_field(P, variant const&, variant_ref)
     { assert(false); }
 
-    static void set_field(P, variant&, argument const&)
+    static void set_field(P, variant&, variant_ref)
     { assert(false); }
 
 private:
@@ -688,7 +599,7 @@ struct property_invoker<P, member_pointer>
     static variant get_static(P)
     { assert(false); return variant::empty_variant; }
 
-    static void set_static(P, argument const&)
+    static void set_static(P, variant_ref)
     { assert(false); }
 
     static variant get_field(P property, variant const &instance)
@@ -701,7 +612,7 @@ struct property_invoker<P, member_pointer>
         return variant::empty_variant;
     }
 
-    static void set_field(P property, variant const &instance, argument const &arg)
+    static void set_field(P property, variant const &instance, variant_ref arg)
     {
         using namespace std::literals;
         if constexpr(std::is_const_v<T>)
@@ -713,11 +624,11 @@ struct property_invoker<P, member_pointer>
                 throw bad_variant_cast{"Incompatible types: const rtti::variant& -> "s +
                                        type_name<class_ref_t>()};
             else if (type.isClassPtr())
-                instance.to<C*>()->*property = arg.value<T>();
+                instance.to<C*>()->*property = argument{arg}.value<T>();
         }
     }
 
-    static void set_field(P property, variant &instance, argument const &arg)
+    static void set_field(P property, variant &instance, variant_ref arg)
     {
         if constexpr(std::is_const_v<T>)
             throw invoke_error{"Write to readonly property"};
@@ -725,9 +636,9 @@ struct property_invoker<P, member_pointer>
         {
             auto type = MetaType{instance.typeId()};
             if (type.isClass())
-                instance.ref<C>().*property = arg.value<T>();
+                instance.ref<C>().*property = argument{arg}.value<T>();
             else if (type.isClassPtr())
-                instance.to<C*>()->*property = arg.value<T>();
+                instance.to<C*>()->*property = argument{arg}.value<T>();
         }
     }
 private:
@@ -757,16 +668,16 @@ struct PropertyInvoker: IPropertyInvoker
     variant get_static() const override
     { return invoker_t::get_static(m_prop); }
 
-    void set_static(argument arg) const override
+    void set_static(variant_ref arg) const override
     { invoker_t::set_static(m_prop, arg); }
 
     variant get_field(variant const &instance) const override
     { return invoker_t::get_field(m_prop, instance); }
 
-    void set_field(variant const &instance, argument arg) const override
+    void set_field(variant const &instance, variant_ref arg) const override
     { invoker_t::set_field(m_prop, instance, arg); }
 
-    void set_field(variant &instance, argument arg) const override
+    void set_field(variant &instance, variant_ref arg) const override
     { invoker_t::set_field(m_prop, instance, arg); }
 
 private:
@@ -790,19 +701,19 @@ struct PropertyInvokerEx: IPropertyInvoker
     { return false; }
 
     variant get_static() const override
-    { return MethodInvoker<G>(m_get).invoke_static(); }
+    { return MethodInvoker<G>(m_get).invoke_static({}); }
 
-    void set_static(argument arg) const override
-    { MethodInvoker<S>{m_set}.invoke_static(std::move(arg)); }
+    void set_static(variant_ref arg) const override
+    { MethodInvoker<S>{m_set}.invoke_static({&arg, 1}); }
 
     variant get_field(variant const &instance) const override
-    { return MethodInvoker<G>{m_get}.invoke_method(instance); }
+    { return MethodInvoker<G>{m_get}.invoke_method(instance, {}); }
 
-    void set_field(variant const &instance, argument arg) const override
-    { MethodInvoker<S>{m_set}.invoke_method(instance, std::move(arg)); }
+    void set_field(variant const &instance, variant_ref arg) const override
+    { MethodInvoker<S>{m_set}.invoke_method(instance, {&arg, 1}); }
 
-    void set_field(variant &instance, argument arg) const override
-    { MethodInvoker<S>{m_set}.invoke_method(instance, std::move(arg)); }
+    void set_field(variant &instance, variant_ref arg) const override
+    { MethodInvoker<S>{m_set}.invoke_method(instance, {&arg, 1}); }
 
 private:
     static constexpr auto valid = conditional_v<
@@ -1017,7 +928,8 @@ private:
 
         EXPAND(
             item->addBaseClass(metaTypeId<mpl::typelist_get_t<L, I>>(),
-                &internal::metacast_to_base<T, mpl::typelist_get_t<L, I>>, {})
+                &internal::metacast_to_base<T, mpl::typelist_get_t<L, I>>,
+                internal::is_virtual_base_of<T, mpl::typelist_get_t<L, I>>::value, {})
         )
     }
 
@@ -3,6 +3,7 @@
 
 #include <rtti/export.h>
 #include <rtti/defines.h>
+#include <rtti/symbol.h>
 
 #include <functional>
 #include <memory>
@@ -45,6 +46,7 @@ public:
     variant const& attribute(std::size_t index) const;
     std::string const &attributeName(std::size_t index) const;
     variant const& attribute(std::string_view name) const;
+    variant const& attribute(symbol name) const;
     void for_each_attribute(enum_attribute_t const &func) const;
 protected:
     explicit MetaItem(std::string_view name, MetaContainer const &owner);
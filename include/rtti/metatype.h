@@ -10,6 +10,13 @@
 #include <rtti/typename.h>
 #include <rtti/tagged_id.h>
 
+#include <cstring>
+#include <memory>
+#include <new>
+#include <optional>
+#include <tuple>
+#include <utility>
+
 namespace rtti {
 
 namespace internal {
@@ -32,6 +39,8 @@ struct TypeInfo;
 class MetaClass;
 class variant;
 class argument;
+class variant_column;
+class MemoryResource;
 /* end forward */
 
 using MetaType_ID = mpl::ID<internal::meta_type_tag, std::size_t, 0>;
@@ -66,6 +75,8 @@ enum class TypeFlags: std::uint32_t {
     Destructible         = 1 << 22,
 
     EQ_Comparable        = 1 << 23,
+    Hashable             = 1 << 24,
+    LT_Comparable        = 1 << 25,
 };
 
 BITMASK_ENUM(TypeFlags)
@@ -76,17 +87,22 @@ public:
     MetaType() noexcept = default;
     explicit MetaType(MetaType_ID typeId) noexcept;
     explicit MetaType(std::string_view name) noexcept;
+    static MetaType fromIndex(std::uint32_t index) noexcept;
 
     bool valid() const noexcept
     {
         return (m_typeInfo != nullptr);
     }
     MetaType_ID typeId() const noexcept;
+    // Dense registration index in [1, typeCount()], 0 for void
+    std::uint32_t index() const noexcept;
+    static std::uint32_t typeCount() noexcept;
     MetaType_ID decayId() const noexcept;
     bool decayed() const noexcept
     { return valid() && (typeId() == decayId()); }
     std::string_view typeName() const noexcept;
     std::size_t typeSize() const noexcept;
+    std::size_t typeAlign() const noexcept;
     TypeFlags typeFlags() const noexcept;
 
     inline bool isConst() const noexcept;
@@ -99,14 +115,38 @@ public:
     inline bool isClassPtr() const noexcept;
     inline bool isFunctionPtr() const noexcept;
     inline bool isArray() const noexcept;
+    inline bool isHashable() const noexcept;
+    inline bool isLtComparable() const noexcept;
 
     uint16_t pointerArity() const noexcept;
     static bool compatible(MetaType fromType, MetaType toType) noexcept;
 
     MetaClass const* metaClass() const noexcept;
 
+    // std::hash of value, 0 if type isn't Hashable
+    std::size_t hash(void const *value) const;
+    // Ordering by operator<, throws if type isn't LT_Comparable
+    bool less(void const *lhs, void const *rhs) const;
+    // Returns negative, zero or positive value
+    int compare(void const *lhs, void const *rhs) const;
+
     void* construct(void *copy = nullptr, bool movable = false) const;
     void destruct(void *instance) const;
+    // Per call resource, instance must be destructed with the same one
+    void* construct(void *copy, bool movable, MemoryResource *resource) const;
+    void destruct(void *instance, MemoryResource *resource) const;
+
+    // Resource used by construct/destruct of decayed type, nullptr means global new/delete.
+    // Should be set before any instance is constructed.
+    void setMemoryResource(MemoryResource *resource) const noexcept;
+    MemoryResource* memoryResource() const noexcept;
+
+    // Lifecycle of count contiguous objects. If construction of an element throws,
+    // already constructed elements are destroyed before the exception is propagated.
+    void construct_n(void *where, std::size_t count) const;
+    void copy_n(void const *source, void *where, std::size_t count) const;
+    void move_n(void *source, void *where, std::size_t count) const;
+    void destroy_n(void *ptr, std::size_t count) const noexcept;
 
     static bool hasConverter(MetaType fromType, MetaType toType) noexcept;
     static bool hasConverter(MetaType_ID fromTypeId, MetaType_ID toTypeId) noexcept;
@@ -131,8 +171,26 @@ public:
     static void unregisterConverter(MetaType_ID fromTypeId, MetaType_ID toTypeId);
     template<typename From, typename To>
     static void unregisterConverter();
+
+    // Converts count contiguous values into uninitialized storage. Arithmetic pairs use
+    // built-in loops, other types resolve converter once and apply it to every element.
+    // On failure nothing is left constructed in destination: values already converted
+    // are destroyed, then false is returned or exception thrown by converter is rethrown.
+    static bool convert_n(void const *from, MetaType fromType, void *to, MetaType toType,
+                          std::size_t count);
+
+    // When enabled, conversion without direct converter goes through the shortest
+    // chain of registered converters. Resolved chains are cached until next registration.
+    static void setConverterChaining(bool enable);
+    static bool converterChaining() noexcept;
+
+    // After sealing, lookup by name reads an immutable snapshot without locking.
+    // Types registered later are still accepted: until their number reaches the size
+    // of the snapshot they are found under the registry lock, then snapshot is rebuilt.
+    static void sealRegistry();
+    static bool registrySealed() noexcept;
 private:
-    static MetaType_ID registerMetaType(std::string_view name, std::size_t size,
+    static MetaType_ID registerMetaType(std::string_view name, std::size_t size, std::size_t align,
         MetaType_ID decay, uint16_t arity, uint16_t const_mask,
         TypeFlags flags, metatype_manager_t const *manager);
 
@@ -168,14 +226,15 @@ private:
         template<typename> friend class internal::meta_type;
     };
     friend class rtti::variant;
+    friend class rtti::variant_column;
 public:
     TypeInfo const* typeInfo(TypeInfoKey) const
     { return m_typeInfo; }
-    static MetaType_ID registerMetaType(std::string_view name, std::size_t size,
+    static MetaType_ID registerMetaType(std::string_view name, std::size_t size, std::size_t align,
                                         MetaType_ID decay, uint16_t arity, uint16_t const_mask,
                                         TypeFlags flags, metatype_manager_t const *manager,
                                         RegisterTypeKey)
-    { return registerMetaType(name, size, decay, arity, const_mask, flags, manager); }
+    { return registerMetaType(name, size, align, decay, arity, const_mask, flags, manager); }
 };
 
 //forward
@@ -183,6 +242,42 @@ template <typename T> MetaType_ID metaTypeId();
 
 namespace internal {
 
+// Arrays are hashed and ordered element-wise
+template<typename T>
+constexpr auto is_hashable_v = has_hash_v<remove_all_cv_t<std::remove_all_extents_t<T>>>;
+
+// Std containers and wrappers declare operator< for any element type,
+// so ordering is checked down to the elements
+template<typename T, typename = std::void_t<>>
+struct is_less_comparable: has_less<T const&, T const&>
+{};
+
+template<typename T>
+struct is_less_comparable<T, std::void_t<typename T::value_type, decltype(std::declval<T const&>().begin())>>
+    : std::conjunction<has_less<T const&, T const&>,
+                       std::conditional_t<std::is_same_v<std::remove_cv_t<typename T::value_type>, std::remove_cv_t<T>>,
+                                          std::true_type,
+                                          is_less_comparable<std::remove_cv_t<typename T::value_type>>>>
+{};
+
+template<typename T1, typename T2>
+struct is_less_comparable<std::pair<T1, T2>>
+    : std::conjunction<is_less_comparable<std::remove_cv_t<T1>>, is_less_comparable<std::remove_cv_t<T2>>>
+{};
+
+template<typename ...Ts>
+struct is_less_comparable<std::tuple<Ts...>>
+    : std::conjunction<is_less_comparable<std::remove_cv_t<Ts>>...>
+{};
+
+template<typename T>
+struct is_less_comparable<std::optional<T>>: is_less_comparable<std::remove_cv_t<T>>
+{};
+
+template<typename T>
+constexpr auto is_less_comparable_v =
+    is_less_comparable<std::remove_cv_t<std::remove_reference_t<std::remove_all_extents_t<T>>>>::value;
+
 struct RTTI_PRIVATE type_function_table
 {
     using allocate_t = void* (*) ();
@@ -194,6 +289,13 @@ struct RTTI_PRIVATE type_function_table
     using destroy_t = void (*) (void*);
     // comparators
     using compare_eq_t = bool (*) (void const*, void const*);
+    using hash_t = std::size_t (*) (void const*);
+    using compare_less_t = bool (*) (void const*, void const*);
+    // bulk operations
+    using default_construct_n_t = void (*) (void*, std::size_t);
+    using copy_construct_n_t = void (*) (void const*, void*, std::size_t);
+    using move_construct_n_t = void (*) (void*, void*, std::size_t);
+    using destroy_n_t = void (*) (void*, std::size_t);
 
     allocate_t const f_allocate = nullptr;
     deallocate_t const f_deallocate = nullptr;
@@ -203,12 +305,26 @@ struct RTTI_PRIVATE type_function_table
     move_or_copy_t const f_move_or_copy = nullptr;
     destroy_t const f_destroy = nullptr;
     compare_eq_t const f_compare_eq = nullptr;
+    default_construct_n_t const f_default_construct_n = nullptr;
+    copy_construct_n_t const f_copy_construct_n = nullptr;
+    move_construct_n_t const f_move_construct_n = nullptr;
+    destroy_n_t const f_destroy_n = nullptr;
+    // Set only for Hashable types
+    hash_t const f_hash = nullptr;
+    // Set only for LT_Comparable types
+    compare_less_t const f_compare_less = nullptr;
 
     constexpr type_function_table(allocate_t allocate, deallocate_t deallocate,
                                   default_construct_t default_construct,
                                   copy_construct_t copy_construct, move_construct_t move_construct,
                                   move_or_copy_t move_or_copy, destroy_t destroy,
-                                  compare_eq_t compare_eq) noexcept
+                                  compare_eq_t compare_eq,
+                                  default_construct_n_t default_construct_n,
+                                  copy_construct_n_t copy_construct_n,
+                                  move_construct_n_t move_construct_n,
+                                  destroy_n_t destroy_n,
+                                  hash_t hash,
+                                  compare_less_t compare_less) noexcept
         : f_allocate{allocate}
         , f_deallocate{deallocate}
         , f_default_construct{default_construct}
@@ -217,6 +333,12 @@ struct RTTI_PRIVATE type_function_table
         , f_move_or_copy{move_or_copy}
         , f_destroy{destroy}
         , f_compare_eq{compare_eq}
+        , f_default_construct_n{default_construct_n}
+        , f_copy_construct_n{copy_construct_n}
+        , f_move_construct_n{move_construct_n}
+        , f_destroy_n{destroy_n}
+        , f_hash{hash}
+        , f_compare_less{compare_less}
     {}
 };
 
@@ -225,13 +347,21 @@ struct type_function_table_impl
 {
     static void* allocate()
     {
-        return ::operator new(sizeof(T));
+        if constexpr(alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            return ::operator new(sizeof(T), std::align_val_t{alignof(T)});
+        else
+            return ::operator new(sizeof(T));
     }
 
     static void deallocate(void *ptr)
     {
         if (ptr)
-            ::operator delete(ptr);
+        {
+            if constexpr(alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+                ::operator delete(ptr, std::align_val_t{alignof(T)});
+            else
+                ::operator delete(ptr);
+        }
     }
 
     DISABLE_WARNINGS_PUSH
@@ -292,6 +422,71 @@ struct type_function_table_impl
                 static_cast<T*>(ptr)->~T();
     }
 
+    DISABLE_WARNINGS_PUSH
+    DISABLE_WARNING_INIT_LIST_LIFETIME
+
+    static void default_construct_n([[maybe_unused]] void *where, [[maybe_unused]] std::size_t count)
+        noexcept(std::is_nothrow_default_constructible_v<T>)
+    {
+        using namespace std::literals;
+        if constexpr(std::is_default_constructible_v<T>)
+        {
+            if (!where || !count)
+                return;
+
+            if constexpr(std::is_scalar_v<T> && !std::is_member_pointer_v<T>)
+                std::memset(where, 0, count * sizeof(T));
+            else
+                std::uninitialized_value_construct_n(static_cast<T*>(where), count);
+        }
+        else throw runtime_error("Type T = "s + type_name<T>() + "isn't DefaultConstructible");
+    }
+
+    static void copy_construct_n([[maybe_unused]] void const *source, [[maybe_unused]] void *where,
+                                 [[maybe_unused]] std::size_t count)
+        noexcept(std::is_nothrow_copy_constructible_v<T>)
+    {
+        using namespace std::literals;
+        if constexpr(std::is_copy_constructible_v<T>)
+        {
+            if (!source || !where || !count)
+                return;
+
+            if constexpr(std::is_trivially_copyable_v<T>)
+                std::memcpy(where, source, count * sizeof(T));
+            else
+                std::uninitialized_copy_n(static_cast<T const*>(source), count, static_cast<T*>(where));
+        }
+        else throw runtime_error("Type T = "s + type_name<T>() + "isn't CopyConstructible");
+    }
+
+    static void move_construct_n([[maybe_unused]] void *source, [[maybe_unused]] void *where,
+                                 [[maybe_unused]] std::size_t count)
+        noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        using namespace std::literals;
+        if constexpr(std::is_move_constructible_v<T>)
+        {
+            if (!source || !where || !count)
+                return;
+
+            if constexpr(std::is_trivially_copyable_v<T>)
+                std::memcpy(where, source, count * sizeof(T));
+            else
+                std::uninitialized_move_n(static_cast<T*>(source), count, static_cast<T*>(where));
+        }
+        else throw runtime_error("Type T = "s + type_name<T>() + "isn't MoveConstructible");
+    }
+
+    DISABLE_WARNINGS_POP
+
+    static void destroy_n([[maybe_unused]] void *ptr, [[maybe_unused]] std::size_t count) noexcept
+    {
+        if constexpr(!std::is_trivially_destructible_v<T>)
+            if (ptr)
+                std::destroy_n(static_cast<T*>(ptr), count);
+    }
+
     static bool compare_eq(void const *lhs, void const *rhs)
         noexcept(has_nt_eq_v<T, T>)
     {
@@ -306,6 +501,16 @@ struct type_function_table_impl
         }
         else throw runtime_error("Type T = "s + type_name<T>() + "isn't EQ_comparable");
     }
+
+    static std::size_t hash(void const *value)
+    {
+        return std::hash<T>{}(*static_cast<T const*>(value));
+    }
+
+    static bool compare_less(void const *lhs, void const *rhs)
+    {
+        return (*static_cast<T const*>(lhs) < *static_cast<T const*>(rhs));
+    }
 };
 
 template<typename T, std::size_t N>
@@ -316,13 +521,21 @@ struct type_function_table_impl<T[N]>
 
     static void* allocate()
     {
-        return ::operator new(Length*sizeof(Base));
+        if constexpr(alignof(Base) > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            return ::operator new(Length*sizeof(Base), std::align_val_t{alignof(Base)});
+        else
+            return ::operator new(Length*sizeof(Base));
     }
 
     static void deallocate(void *ptr)
     {
         if (ptr)
-            ::operator delete(ptr);
+        {
+            if constexpr(alignof(Base) > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+                ::operator delete(ptr, std::align_val_t{alignof(Base)});
+            else
+                ::operator delete(ptr);
+        }
     }
 
     static void default_construct([[maybe_unused]] void *where)
@@ -395,6 +608,29 @@ struct type_function_table_impl<T[N]>
             }
     }
 
+    static void default_construct_n(void *where, std::size_t count)
+        noexcept(std::is_nothrow_default_constructible<Base>::value)
+    {
+        type_function_table_impl<Base>::default_construct_n(where, count * Length);
+    }
+
+    static void copy_construct_n(void const *source, void *where, std::size_t count)
+        noexcept(std::is_nothrow_copy_constructible<Base>::value)
+    {
+        type_function_table_impl<Base>::copy_construct_n(source, where, count * Length);
+    }
+
+    static void move_construct_n(void *source, void *where, std::size_t count)
+        noexcept(std::is_nothrow_move_constructible<Base>::value)
+    {
+        type_function_table_impl<Base>::move_construct_n(source, where, count * Length);
+    }
+
+    static void destroy_n(void *ptr, std::size_t count) noexcept
+    {
+        type_function_table_impl<Base>::destroy_n(ptr, count * Length);
+    }
+
     static bool compare_eq(void const *lhs, void const *rhs)
         noexcept(has_nt_eq_v<T, T>)
     {
@@ -414,6 +650,22 @@ struct type_function_table_impl<T[N]>
         else throw runtime_error("Type T = "s + type_name<T>() + "isn't EQ_Comparable");
     }
 
+    static std::size_t hash(void const *value)
+    {
+        auto *item = static_cast<Base const*>(value);
+        auto result = std::size_t{Length};
+        for (std::size_t i = 0; i < Length; ++i)
+            result = result * 31 + type_function_table_impl<Base>::hash(item + i);
+        return result;
+    }
+
+    static bool compare_less(void const *lhs, void const *rhs)
+    {
+        auto *first1 = static_cast<Base const*>(lhs);
+        auto *first2 = static_cast<Base const*>(rhs);
+        return std::lexicographical_compare(first1, first1 + Length, first2, first2 + Length);
+    }
+
 };
 
 template <typename T>
@@ -432,6 +684,24 @@ inline T move_or_copy(void *source)
     throw runtime_error("Type T = "s + type_name<T>() + "isn't CopyConstructible");
 }
 
+template<typename T>
+constexpr type_function_table::hash_t type_hash_function() noexcept
+{
+    if constexpr(is_hashable_v<T>)
+        return &type_function_table_impl<T>::hash;
+    else
+        return nullptr;
+}
+
+template<typename T>
+constexpr type_function_table::compare_less_t type_compare_less_function() noexcept
+{
+    if constexpr(is_less_comparable_v<T>)
+        return &type_function_table_impl<T>::compare_less;
+    else
+        return nullptr;
+}
+
 template<typename T>
 inline type_function_table const* type_function_table_for() noexcept
 {
@@ -443,7 +713,13 @@ inline type_function_table const* type_function_table_for() noexcept
         &type_function_table_impl<T>::move_construct,
         &type_function_table_impl<T>::move_or_copy,
         &type_function_table_impl<T>::destroy,
-        &type_function_table_impl<T>::compare_eq
+        &type_function_table_impl<T>::compare_eq,
+        &type_function_table_impl<T>::default_construct_n,
+        &type_function_table_impl<T>::copy_construct_n,
+        &type_function_table_impl<T>::move_construct_n,
+        &type_function_table_impl<T>::destroy_n,
+        type_hash_function<T>(),
+        type_compare_less_function<T>()
     };
     return &result;
 }
@@ -483,6 +759,8 @@ struct type_flags {
         | (std::is_move_assignable_v<base>         ? Flags::MoveAssignable         : Flags::None)
         | (std::is_destructible_v<base>            ? Flags::Destructible           : Flags::None)
         | (has_eq_v<no_ref,no_ref>                 ? Flags::EQ_Comparable          : Flags::None)
+        | (is_hashable_v<remove_all_cv_t<no_ref>>  ? Flags::Hashable               : Flags::None)
+        | (is_less_comparable_v<no_ref>            ? Flags::LT_Comparable          : Flags::None)
     ;
 };
 
@@ -503,10 +781,11 @@ class meta_type final
         auto const &name = type_name<T>();
         auto constexpr flags = type_flags<T>::value;
         auto constexpr size = size_of_v<T>;
+        auto constexpr align = align_of_v<T>;
         std::uint16_t constexpr arity = pointer_arity<NoRef>::value;
         std::uint16_t constexpr const_mask = const_bitset<NoRef>::value;
         auto *manager = type_function_table_for<U>();
-        meta_id = MetaType::registerMetaType(name, size, decay,
+        meta_id = MetaType::registerMetaType(name, size, align, decay,
                                              arity, const_mask, flags,
                                              manager, {});
     }
@@ -604,6 +883,16 @@ inline bool MetaType::isArray() const noexcept
            ((flags & TypeFlags::Pointer) == TypeFlags::None);
 }
 
+inline bool MetaType::isHashable() const noexcept
+{
+    return ((typeFlags() & TypeFlags::Hashable) == TypeFlags::Hashable);
+}
+
+inline bool MetaType::isLtComparable() const noexcept
+{
+    return ((typeFlags() & TypeFlags::LT_Comparable) == TypeFlags::LT_Comparable);
+}
+
 //--------------------------------------------------------------------------------------------------------------------------------
 // Converters
 //--------------------------------------------------------------------------------------------------------------------------------
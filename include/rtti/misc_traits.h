@@ -45,6 +45,17 @@ constexpr auto size_of_v = size_of<T>::value;
 template<typename T>
 using size_of_t = typename size_of<T>::type;
 
+template<typename T>
+struct align_of: std::integral_constant<std::size_t, alignof(T)>
+{};
+
+template<>
+struct align_of<void>: std::integral_constant<std::size_t, 0>
+{};
+
+template<typename T>
+constexpr auto align_of_v = align_of<T>::value;
+
 //-----------------------------------------------------------------------------------------------------------------------------
 
 template<typename T, std::size_t I>
@@ -367,6 +378,40 @@ constexpr auto has_nt_eq_v = has_nt_eq<T, U>::value;
 
 //-----------------------------------------------------------------------------------------------------------------------------
 
+template<typename T, typename U, typename = std::void_t<>>
+struct has_less: std::false_type
+{};
+
+template<typename T, typename U>
+struct has_less<T, U, std::void_t<decltype(std::declval<T>() < std::declval<U>())>>
+    : std::true_type
+{};
+
+template<typename T, typename U>
+using has_less_t = typename has_less<T, U>::type;
+
+template<typename T, typename U>
+constexpr auto has_less_v = has_less<T, U>::value;
+
+//-----------------------------------------------------------------------------------------------------------------------------
+
+template<typename T, typename = std::void_t<>>
+struct has_hash: std::false_type
+{};
+
+template<typename T>
+struct has_hash<T, std::void_t<decltype(std::hash<T>{}(std::declval<T const&>()))>>
+    : std::true_type
+{};
+
+template<typename T>
+using has_hash_t = typename has_hash<T>::type;
+
+template<typename T>
+constexpr auto has_hash_v = has_hash<T>::value;
+
+//-----------------------------------------------------------------------------------------------------------------------------
+
 template<typename T>
 struct is_template_type: std::false_type
 {
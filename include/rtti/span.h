@@ -0,0 +1,106 @@
+﻿#ifndef SPAN_H
+#define SPAN_H
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace rtti {
+
+// Minimal replacement of C++20 std::span with dynamic extent
+template<typename T>
+class span final
+{
+public:
+    using element_type = T;
+    using value_type = std::remove_cv_t<T>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using const_pointer = T const*;
+    using reference = T&;
+    using const_reference = T const&;
+    using iterator = T*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+
+    constexpr span() noexcept = default;
+    constexpr span(T *data, size_type size) noexcept
+        : m_data{data}
+        , m_size{size}
+    {}
+
+    template<std::size_t N>
+    constexpr span(T (&array)[N]) noexcept
+        : m_data{array}
+        , m_size{N}
+    {}
+
+    template<typename Container,
+             typename = std::enable_if_t<
+                 !std::is_same_v<std::remove_cv_t<Container>, span> &&
+                 std::is_convertible_v<decltype(std::declval<Container&>().data()), T*>>>
+    constexpr span(Container &container) noexcept(noexcept(container.data()))
+        : m_data{container.data()}
+        , m_size{container.size()}
+    {}
+
+    template<typename U,
+             typename = std::enable_if_t<std::is_convertible_v<U(*)[], T(*)[]>>>
+    constexpr span(span<U> const &other) noexcept
+        : m_data{other.data()}
+        , m_size{other.size()}
+    {}
+
+    constexpr pointer data() const noexcept
+    { return m_data; }
+    constexpr size_type size() const noexcept
+    { return m_size; }
+    constexpr size_type size_bytes() const noexcept
+    { return m_size * sizeof(T); }
+    constexpr bool empty() const noexcept
+    { return m_size == 0; }
+
+    constexpr reference operator[](size_type index) const noexcept
+    {
+        assert(index < m_size);
+        return m_data[index];
+    }
+    constexpr reference front() const noexcept
+    { return (*this)[0]; }
+    constexpr reference back() const noexcept
+    { return (*this)[m_size - 1]; }
+
+    constexpr iterator begin() const noexcept
+    { return m_data; }
+    constexpr iterator end() const noexcept
+    { return m_data + m_size; }
+    constexpr reverse_iterator rbegin() const noexcept
+    { return reverse_iterator{end()}; }
+    constexpr reverse_iterator rend() const noexcept
+    { return reverse_iterator{begin()}; }
+
+    constexpr span first(size_type count) const noexcept
+    {
+        assert(count <= m_size);
+        return {m_data, count};
+    }
+    constexpr span last(size_type count) const noexcept
+    {
+        assert(count <= m_size);
+        return {m_data + (m_size - count), count};
+    }
+    constexpr span subspan(size_type offset, size_type count) const noexcept
+    {
+        assert(offset <= m_size && count <= m_size - offset);
+        return {m_data + offset, count};
+    }
+
+private:
+    T *m_data = nullptr;
+    size_type m_size = 0;
+};
+
+} // namespace rtti
+
+#endif // SPAN_H
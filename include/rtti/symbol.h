@@ -0,0 +1,72 @@
+﻿#ifndef SYMBOL_H
+#define SYMBOL_H
+
+#include <rtti/export.h>
+
+#include <cstddef>
+#include <functional>
+#include <string_view>
+
+namespace rtti {
+
+namespace internal {
+
+struct symbol_entry
+{
+    std::string_view name;
+    std::size_t hash;
+    std::size_t id;
+};
+
+} // namespace internal
+
+// Name interned in global table. Symbols are compared by identity and carry
+// precomputed hash and dense id, which is 0 only for empty symbol.
+class RTTI_API symbol final
+{
+public:
+    constexpr symbol() noexcept = default;
+    explicit symbol(std::string_view name);
+
+    // Returns empty symbol if name wasn't interned yet
+    static symbol find(std::string_view name);
+
+    std::string_view str() const noexcept
+    { return m_entry ? m_entry->name : std::string_view{}; }
+    std::size_t hash() const noexcept
+    { return m_entry ? m_entry->hash : 0; }
+    std::size_t id() const noexcept
+    { return m_entry ? m_entry->id : 0; }
+    bool empty() const noexcept
+    { return !m_entry; }
+
+    explicit operator std::string_view() const noexcept
+    { return str(); }
+
+    friend bool operator==(symbol lhs, symbol rhs) noexcept
+    { return lhs.m_entry == rhs.m_entry; }
+    friend bool operator!=(symbol lhs, symbol rhs) noexcept
+    { return lhs.m_entry != rhs.m_entry; }
+
+private:
+    explicit symbol(internal::symbol_entry const *entry) noexcept
+        : m_entry{entry}
+    {}
+
+    internal::symbol_entry const *m_entry = nullptr;
+};
+
+} // namespace rtti
+
+namespace std {
+
+template<>
+struct hash<rtti::symbol>
+{
+    std::size_t operator()(rtti::symbol value) const noexcept
+    { return value.hash(); }
+};
+
+} // namespace std
+
+#endif // SYMBOL_H
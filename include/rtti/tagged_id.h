@@ -61,7 +61,7 @@ struct hash<mpl::ID<Tag, Type, default_value>>
 
     result_type operator()(argument_type const &id) const
     {
-        return std::hash<Type>(id.value());
+        return std::hash<Type>{}(id.value());
     }
 };
 
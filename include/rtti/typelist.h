@@ -4,6 +4,7 @@
 #include <tuple>
 #include <type_traits>
 #include <cstdint>
+#include <initializer_list>
 
 namespace mpl {
 
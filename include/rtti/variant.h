@@ -4,9 +4,17 @@
 #include <rtti/metaclass.h>
 #include <rtti/metatype.h>
 #include <rtti/metaerror.h>
+#include <rtti/memoryresource.h>
 #include <rtti/finally.h>
+#include <rtti/span.h>
+#include <rtti/config.h>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cassert>
+#include <cstring>
+#include <optional>
 
 namespace rtti {
 
@@ -14,10 +22,28 @@ namespace rtti {
 // Variant
 //--------------------------------------------------------------------------------------------------------------------------------
 
+// Specialize as std::true_type to let variant copies share one heap stored value.
+// Shared value is cloned on first mutable access.
+template<typename T>
+struct variant_copy_on_write: std::false_type
+{};
+
+// Result of non-throwing variant access
+enum class variant_error
+{
+    NONE,
+    EMPTY,
+    INCOMPATIBLE,
+    SUBOBJECT_POINTER
+};
+
 namespace internal {
 
-    constexpr auto STORAGE_ALIGN = sizeof(void *);
-    constexpr auto STORAGE_SIZE  = sizeof(void *) * 2;
+    // Set by RTTI_VARIANT_STORAGE_SIZE and RTTI_VARIANT_STORAGE_ALIGN build options
+    constexpr std::size_t STORAGE_ALIGN = RTTI_VARIANT_STORAGE_ALIGN;
+    constexpr std::size_t STORAGE_SIZE  = RTTI_VARIANT_STORAGE_SIZE;
+    static_assert(STORAGE_SIZE >= sizeof(void *) * 2 && STORAGE_ALIGN >= alignof(void *),
+                  "Variant storage should fit at least two pointers");
 
     union RTTI_API variant_type_storage
     {
@@ -25,6 +51,8 @@ namespace internal {
         std::aligned_storage_t<STORAGE_SIZE, STORAGE_ALIGN> buffer;
     };
 
+    struct variant_access;
+
     enum class type_attribute
     {
         NONE,
@@ -43,7 +71,9 @@ namespace internal {
         using move_t           = void (*)(variant_type_storage &, variant_type_storage &);
         using destroy_t        = void (*)(variant_type_storage &);
         using compare_eq_t     = bool (*)(variant_type_storage const &, void const *);
+        using hash_t           = std::size_t (*)(variant_type_storage const &);
         using info_t           = ClassInfo (*)(variant_type_storage const &);
+        using detach_t         = void (*)(variant_type_storage &);
 
         type_t const f_type                     = nullptr;
         access_t const f_access                 = nullptr;
@@ -53,11 +83,19 @@ namespace internal {
         move_t const f_move                     = nullptr;
         destroy_t const f_destroy               = nullptr;
         compare_eq_t const f_compare_eq         = nullptr;
+        hash_t const f_hash                     = nullptr;
         info_t const f_info                     = nullptr;
+        // Set only for copy-on-write types
+        detach_t const f_detach                 = nullptr;
+        // Storage is copied bitwise and destroy is no-op
+        bool const trivially_copyable           = false;
+        // Storage can be moved bitwise, source is left empty
+        bool const trivially_relocatable        = false;
 
         variant_function_table(type_t type, access_t access, copy_construct_t copy_construct,
                                move_construct_t move_construct, copy_t copy, move_t move,
-                               destroy_t destroy, compare_eq_t compare_eq, info_t info) noexcept
+                               destroy_t destroy, compare_eq_t compare_eq, hash_t hash, info_t info,
+                               detach_t detach, bool trivially_copyable, bool trivially_relocatable) noexcept
             : f_type{type}
             , f_access{access}
             , f_copy_construct{copy_construct}
@@ -66,13 +104,20 @@ namespace internal {
             , f_move{move}
             , f_destroy{destroy}
             , f_compare_eq{compare_eq}
+            , f_hash{hash}
             , f_info(info)
+            , f_detach{detach}
+            , trivially_copyable{trivially_copyable}
+            , trivially_relocatable{trivially_relocatable}
         {}
     };
 
 } // namespace internal
 
 class argument;
+class variant_ref;
+class variant_column;
+class method_handle;
 
 class RTTI_API variant final
 {
@@ -100,6 +145,10 @@ public:
 
     bool operator==(variant const &value) const;
 
+    // Consistent with operator==, types without std::hash are hashed by type name
+    std::size_t hash() const
+    { return manager->f_hash(storage); }
+
     template<typename T>
     bool operator==(T const &value) const
     {
@@ -112,6 +161,10 @@ public:
         return !(*this == value);
     }
 
+    // Empty variant goes first, then values are ordered by type registration index
+    // and by operator< within the same type
+    bool operator<(variant const &value) const;
+
     template<typename T>
     bool eq(T const &value) const;
 
@@ -130,6 +183,13 @@ public:
     template<typename T>
     bool is()
     {
+        if constexpr (!std::is_rvalue_reference_v<T>)
+        {
+            using U = std::conditional_t<std::is_lvalue_reference_v<T>, std::remove_reference_t<T>, std::add_const_t<T>>;
+            if (exact_ptr<U, false>())
+                return true;
+        }
+
         auto typeId = internalTypeId(type_attribute::LREF);
         return metafunc_is<T>::invoke(*this, typeId);
     }
@@ -137,6 +197,10 @@ public:
     template<typename T>
     bool is() const
     {
+        if constexpr (!std::is_reference_v<T> || std::is_same_v<T, std::remove_reference_t<T> const&>)
+            if (exact_ptr<std::add_const_t<std::remove_reference_t<T>>, false>())
+                return true;
+
         auto typeId = internalTypeId(type_attribute::LREF_CONST);
         return metafunc_is<T>::invoke(*this, typeId);
     }
@@ -146,6 +210,9 @@ public:
     {
         using U = std::remove_reference_t<T>;
 
+        if (auto *result = exact_ptr<U>())
+            return *result;
+
         auto fromId = internalTypeId(type_attribute::LREF);
         auto toId   = metaTypeId<std::add_lvalue_reference_t<U>>();
 
@@ -158,6 +225,9 @@ public:
     {
         using U = std::add_const_t<std::remove_reference_t<T>>;
 
+        if (auto const *result = exact_ptr<U>())
+            return *result;
+
         auto fromId = internalTypeId(type_attribute::LREF_CONST);
         auto toId   = metaTypeId<std::add_lvalue_reference_t<U>>();
 
@@ -182,6 +252,9 @@ public:
     {
         using U = std::remove_reference_t<T>;
 
+        if (auto *result = exact_ptr<U>())
+            return std::move(*result);
+
         auto fromId = internalTypeId(type_attribute::RREF);
         auto toId   = metaTypeId<std::add_rvalue_reference_t<U>>();
 
@@ -194,6 +267,9 @@ public:
     {
         using U = std::add_const_t<std::remove_reference_t<T>>;
 
+        if (auto const *result = exact_ptr<U>())
+            return *result;
+
         auto fromId = internalTypeId(type_attribute::LREF);
         auto toId   = metaTypeId<std::add_lvalue_reference_t<U>>();
 
@@ -206,6 +282,9 @@ public:
     {
         using U = std::add_const_t<std::remove_reference_t<T>>;
 
+        if (auto const *result = exact_ptr<U>())
+            return *result;
+
         auto fromId = internalTypeId(type_attribute::LREF_CONST);
         auto toId   = metaTypeId<std::add_lvalue_reference_t<U>>();
 
@@ -214,39 +293,41 @@ public:
     }
 
     template<typename T>
-    T* data()
+    T* try_ref()
     {
         using U = std::remove_reference_t<T>;
 
+        if (auto *result = exact_ptr<U>())
+            return result;
+
         auto fromId = internalTypeId(type_attribute::LREF);
         auto toId   = metaTypeId<std::add_lvalue_reference_t<U>>();
-        try
-        {
-            return metafunc_cast<U>::invoke(*this, fromId, toId);
-        }
-        catch (...)
-        {
-            return nullptr;
-        }
+        auto error  = variant_error::NONE;
+        return metafunc_cast<U>::try_invoke(*this, fromId, toId, error);
     }
 
     template<typename T>
-    T const* data() const
+    T const* try_ref() const
     {
         using U = std::add_const_t<std::remove_reference_t<T>>;
 
+        if (auto const *result = exact_ptr<U>())
+            return result;
+
         auto fromId = internalTypeId(type_attribute::LREF_CONST);
         auto toId   = metaTypeId<std::add_lvalue_reference_t<U>>();
-        try
-        {
-            return metafunc_cast<U>::invoke(*this, fromId, toId);
-        }
-        catch (...)
-        {
-            return nullptr;
-        }
+        auto error  = variant_error::NONE;
+        return metafunc_cast<U>::try_invoke(*this, fromId, toId, error);
     }
 
+    template<typename T>
+    T* data()
+    { return try_ref<T>(); }
+
+    template<typename T>
+    T const* data() const
+    { return try_ref<T>(); }
+
     template<typename T>
     T to()
     {
@@ -260,6 +341,39 @@ public:
         return internal::move_or_copy<T>(&buffer);
     }
 
+    template<typename T>
+    std::optional<T> try_to()
+    {
+        static_assert(!std::is_reference_v<T>, "Type cannot be reference");
+
+        std::optional<T> result;
+        convert_to(result, type_attribute::LREF);
+        return result;
+    }
+
+    template<typename T>
+    std::optional<T> try_to() const
+    {
+        static_assert(!std::is_reference_v<T>, "Type cannot be reference");
+
+        std::optional<T> result;
+        convert_to(result, type_attribute::LREF_CONST);
+        return result;
+    }
+
+    // Assigns converted value to result, which is left untouched on error
+    template<typename T>
+    variant_error convert(T &result) const
+    {
+        static_assert(!std::is_reference_v<T>, "Type cannot be reference");
+
+        std::optional<T> value;
+        auto error = convert_to(value, type_attribute::LREF_CONST);
+        if (value)
+            result = std::move(*value);
+        return error;
+    }
+
     template<typename T>
     T to() const
     {
@@ -314,27 +428,41 @@ public:
     {
         try
         {
-            *this = to<T>();
-            return true;
+            if (auto value = try_to<T>())
+            {
+                *this = std::move(*value);
+                return true;
+            }
         }
         catch (...)
-        {
-            return false;
-        }
+        {}
+        return false;
     }
 
     template<typename ...Args>
     variant invoke(std::string_view name, Args&& ...args);
     template<typename ...Args>
     variant invoke(std::string_view name, Args&& ...args) const;
+    template<typename ...Args>
+    variant invoke(symbol name, Args&& ...args);
+    template<typename ...Args>
+    variant invoke(symbol name, Args&& ...args) const;
 
     variant get_property(std::string_view name) const;
+    variant get_property(symbol name) const;
     template<typename T>
     void set_property(std::string_view name, T &&value);
+    template<typename T>
+    void set_property(symbol name, T &&value);
 
     using type_attribute = internal::type_attribute;
     static variant const empty_variant;
 private:
+    template<typename Self, typename Name, typename ...Args>
+    static variant invoke_imp(Self &self, Name name, Args&& ...args);
+    template<typename Name, typename T>
+    void set_property_imp(Name name, T &&value);
+
     void swap(variant &other) noexcept;
 
     // Returns pointer to decayed type
@@ -346,6 +474,34 @@ private:
     ClassInfo classInfo() const noexcept
     { return manager->f_info(storage); }
 
+    template<typename T>
+    variant_error convert_to(std::optional<T> &result, type_attribute attr) const
+    {
+        std::aligned_storage_t<sizeof(T), alignof(T)> buffer;
+
+        auto error = metafunc_to<T>::try_invoke(*this, internalTypeId(attr), &buffer);
+        if (error == variant_error::NONE)
+        {
+            FINALLY { type_manager_t<T>::destroy(&buffer); };
+            result.emplace(internal::move_or_copy<T>(&buffer));
+        }
+        return error;
+    }
+
+    [[noreturn]] static void throw_cast_error(variant_error error, MetaType_ID fromId, MetaType_ID toId);
+    [[noreturn]] static void throw_convert_error(variant_error error, MetaType_ID fromId, MetaType_ID toId);
+
+    // Pointer to value if variant holds exactly T, nullptr otherwise
+    template<typename T, bool Detach = !std::is_const_v<T>>
+    T* exact_ptr() const;
+
+    // Makes shared copy-on-write value unique before mutable access
+    void detach()
+    {
+        if (manager->f_detach)
+            manager->f_detach(storage);
+    }
+
     void constructor(void *value, std::true_type)
     { manager->f_move_construct(value, storage); }
     void constructor(void const *value, std::false_type)
@@ -420,25 +576,36 @@ private:
     {
         static T* invoke(variant const &self, MetaType_ID fromId, MetaType_ID toId)
         {
-            using namespace std::literals;
+            auto error = variant_error::NONE;
+            if (auto *result = try_invoke(self, fromId, toId, error))
+                return result;
+            throw_cast_error(error, fromId, toId);
+        }
 
+        static T* try_invoke(variant const &self, MetaType_ID fromId, MetaType_ID toId, variant_error &error)
+        {
             if (self.empty())
-                throw bad_variant_cast{"Variant is empty"};
-
-            Decay const *result = nullptr;
-
-            auto from = MetaType{fromId};
-            auto to   = MetaType{toId};
-            if (MetaType::compatible(from, to))
             {
-                if (from.decayId() == to.decayId())
-                    result = static_cast<Decay const *>(self.raw_data_ptr());
-                else if (auto ptr = cast(self, from, tag_t{}))
-                    result = static_cast<Decay const *>(ptr);
+                error = variant_error::EMPTY;
+                return nullptr;
             }
 
+            auto *result = find(self, fromId, toId, error);
             if (!result)
-                throw bad_variant_cast{"Incompatible types: "s + from.typeName() + " -> " + to.typeName()};
+            {
+                if (error == variant_error::NONE)
+                    error = variant_error::INCOMPATIBLE;
+                return nullptr;
+            }
+
+            // Shared value is copied only when mutable access succeeds
+            if constexpr (!std::is_const_v<T>)
+            {
+                auto const *data = self.raw_data_ptr();
+                const_cast<variant&>(self).detach();
+                if (data != self.raw_data_ptr())
+                    result = find(self, fromId, toId, error);
+            }
 
             if constexpr (std::is_array_v<T>)
                 return reinterpret_cast<T *>(*result);
@@ -455,13 +622,27 @@ private:
                                                        std::integral_constant<int, 0>
             >>;
 
+        static Decay const* find(variant const &self, MetaType_ID fromId, MetaType_ID toId,
+                                 variant_error &error)
+        {
+            auto from = MetaType{fromId};
+            auto to   = MetaType{toId};
+            if (!MetaType::compatible(from, to))
+                return nullptr;
+
+            if (from.decayId() == to.decayId())
+                return static_cast<Decay const *>(self.raw_data_ptr());
+
+            return static_cast<Decay const *>(cast(self, from, error, tag_t{}));
+        }
+
         // nope
-        static void const* cast(variant const&, MetaType,
+        static void const* cast(variant const&, MetaType, variant_error&,
                                 std::integral_constant<int, 0>)
         { return nullptr; }
 
         // class
-        static void const* cast(variant const &self, MetaType from,
+        static void const* cast(variant const &self, MetaType from, variant_error&,
                                 std::integral_constant<int, 1>)
         {
             if (from.isClass())
@@ -471,7 +652,7 @@ private:
         }
 
         // class ptr
-        static void const* cast(variant const &self, MetaType from,
+        static void const* cast(variant const &self, MetaType from, variant_error &error,
                                 std::integral_constant<int, 2>)
         {
             if (from.isClassPtr())
@@ -481,7 +662,7 @@ private:
                     if (ptr == self.storage.ptr)
                         return &self.storage.ptr;
 
-                    throw bad_variant_cast("Reference to sub-object pointers isn't supported");
+                    error = variant_error::SUBOBJECT_POINTER;
                 }
             }
             return nullptr;
@@ -512,11 +693,16 @@ private:
 
         static void invoke(variant const &self, MetaType_ID typeId, void *buffer)
         {
-            using namespace std::literals;
+            auto error = try_invoke(self, typeId, buffer);
+            if (error != variant_error::NONE)
+                throw_convert_error(error, typeId, metaTypeId<T>());
+        }
 
+        static variant_error try_invoke(variant const &self, MetaType_ID typeId, void *buffer)
+        {
             assert(buffer);
             if (self.empty())
-                throw bad_variant_convert{"Variant is empty"};
+                return variant_error::EMPTY;
 
             auto from = MetaType{typeId};
             auto to   = MetaType{metaTypeId<T>()};
@@ -525,16 +711,16 @@ private:
                 if (from.decayId() == to.decayId())
                 {
                     to.copy_construct(self.raw_data_ptr(), buffer);
-                    return;
+                    return variant_error::NONE;
                 }
                 else if (cast(self, from, to, buffer, tag_t{}))
-                    return;
+                    return variant_error::NONE;
             }
 
             if (MetaType::convert(self.raw_data_ptr(), from, buffer, to))
-                return;
+                return variant_error::NONE;
 
-            throw bad_variant_convert{"Incompatible types: "s + from.typeName() + " -> " + to.typeName()};
+            return variant_error::INCOMPATIBLE;
         }
 
     private:
@@ -607,15 +793,14 @@ private:
 
 private:
     friend class rtti::argument;
-    DECLARE_ACCESS_KEY(RawPtrAccessKey)
-        friend struct std::hash<rtti::variant>;
-    };
+    friend class rtti::variant_ref;
+    friend class rtti::variant_column;
+    friend class rtti::method_handle;
+    friend struct internal::variant_access;
     DECLARE_ACCESS_KEY(SwapAccessKey)
         friend void swap(variant&, variant&) noexcept;
     };
 public:
-    void const* raw_data_ptr(RawPtrAccessKey) const noexcept
-    { return raw_data_ptr(); }
     void swap(variant &other, SwapAccessKey) noexcept
     { swap(other); }
 };
@@ -629,29 +814,59 @@ inline void swap(variant &lhs, variant &rhs) noexcept
 // Argument
 //--------------------------------------------------------------------------------------------------------------------------------
 
+// Non-owning reference to value of any type with its value category,
+// trivially copyable and used to pass arguments to invokers
+class RTTI_API variant_ref final
+{
+public:
+    variant_ref() noexcept = default;
+
+    template<typename T,
+             typename = std::enable_if_t<!std::is_same_v<std::decay_t<T>, variant_ref>>>
+    variant_ref(T &&value) noexcept;
+
+    bool empty() const noexcept
+    { return m_manager == nullptr; }
+
+    bool isRValue() const noexcept
+    { return m_rvalue; }
+
+    MetaType_ID typeId() const noexcept
+    { return empty() ? metaTypeId<void>() : m_manager->f_type(internal::type_attribute::NONE); }
+
+    // Pointer to referenced value if it has exactly type T, nullptr otherwise
+    template<typename T>
+    T* data() const noexcept;
+
+    // Variant referring to the same value
+    variant get() const noexcept;
+
+private:
+    internal::variant_function_table const *m_manager = nullptr;
+    void *m_data = nullptr;
+    bool m_rvalue = false;
+};
+
+// Extracts parameter value from variant_ref, storage for converted value
+// is created only when conversion is required
 class RTTI_API argument final
 {
 public:
-    argument() noexcept = default;
+    argument(variant_ref value) noexcept
+        : m_value{value}
+    {}
     argument(argument const&) = delete;
     argument& operator=(argument const&) = delete;
-    argument(argument&&) noexcept = default;
+    argument(argument&&) = delete;
     argument& operator=(argument&&) = delete;
     ~argument() noexcept = default;
 
-    template<typename T,
-             typename = std::enable_if_t<!std::is_same_v<std::decay_t<T>, argument>>>
-    argument(T &&value) noexcept;
-
     bool empty() const noexcept
     { return m_value.empty(); }
 
     template<typename T> T value() const;
 
 private:
-    bool isVariant() const
-    { return MetaType{m_value.typeId()}.decayId() == metaTypeId<variant>(); }
-
     // rvalue reference
     template<typename T>
     T value(std::integral_constant<int, 0>) const;
@@ -668,45 +883,95 @@ private:
     template<typename T>
     T value(std::integral_constant<int, 3>) const;
 
-    bool m_rvalue;
-    mutable variant m_value;
-    mutable variant m_dummy;
+    variant_ref m_value;
+    // Referenced value as variant, kept alive since array arguments
+    // are resolved to pointer stored in it
+    mutable variant m_view;
+    mutable std::optional<variant> m_buffer;
 };
 
 //--------------------------------------------------------------------------------------------------------------------------------
 // MetaMethod
 //--------------------------------------------------------------------------------------------------------------------------------
 
-struct RTTI_API IMethodInvoker
+// Registered function as seen by typed delegates
+struct method_target
 {
-    enum {
-        MaxNumberOfArguments = 10
-    };
+    // Stored function or member function pointer, nullptr for function objects
+    void const *function = nullptr;
+    MetaType_ID classTypeId = metaTypeId<void>();
+    bool isConst = false;
+};
 
+struct RTTI_API IMethodInvoker
+{
     virtual bool isStatic() const = 0;
     virtual MetaType_ID returnTypeId() const = 0;
     virtual std::vector<MetaType_ID> parametersTypeId() const = 0;
     virtual std::string signature(std::string_view name) const = 0;
-    virtual variant invoke_static(argument arg0 = argument{}, argument arg1 = argument{},
-                                  argument arg2 = argument{}, argument arg3 = argument{},
-                                  argument arg4 = argument{}, argument arg5 = argument{},
-                                  argument arg6 = argument{}, argument arg7 = argument{},
-                                  argument arg8 = argument{}, argument arg9 = argument{}) const = 0;
-    virtual variant invoke_method(const variant &instance,
-                                  argument arg0 = argument{}, argument arg1 = argument{},
-                                  argument arg2 = argument{}, argument arg3 = argument{},
-                                  argument arg4 = argument{}, argument arg5 = argument{},
-                                  argument arg6 = argument{}, argument arg7 = argument{},
-                                  argument arg8 = argument{}, argument arg9 = argument{}) const = 0;
-    virtual variant invoke_method(variant &instance,
-                                  argument arg0 = argument{}, argument arg1 = argument{},
-                                  argument arg2 = argument{}, argument arg3 = argument{},
-                                  argument arg4 = argument{}, argument arg5 = argument{},
-                                  argument arg6 = argument{}, argument arg7 = argument{},
-                                  argument arg8 = argument{}, argument arg9 = argument{}) const = 0;
+    // When result isn't null, return value is constructed there and empty variant is returned.
+    // Result should point to storage of returnTypeId() type, or to pointer for reference type.
+    virtual variant invoke_static(span<variant_ref const> args, void *result = nullptr) const = 0;
+    virtual variant invoke_method(variant const &instance, span<variant_ref const> args,
+                                  void *result = nullptr) const = 0;
+    virtual variant invoke_method(variant &instance, span<variant_ref const> args,
+                                  void *result = nullptr) const = 0;
+    virtual method_target target() const = 0;
     virtual ~IMethodInvoker() = default;
 };
 
+namespace internal {
+
+struct delegate_class;
+
+union delegate_storage
+{
+    void (*function)();
+    void (delegate_class::*method)();
+};
+
+} // namespace internal
+
+template<typename Signature> class method_delegate;
+
+// Calls registered function directly, without boxing arguments and result.
+// Member function is bound as R(C&, Args...) or R(C const&, Args...).
+template<typename R, typename ...Args>
+class method_delegate<R(Args...)> final
+{
+public:
+    method_delegate() noexcept = default;
+
+    explicit operator bool() const noexcept
+    { return m_thunk != nullptr; }
+
+    R operator()(Args... args) const
+    {
+        assert(m_thunk);
+        return m_thunk(m_storage, std::forward<Args>(args)...);
+    }
+
+private:
+    using storage_t = internal::delegate_storage;
+    using thunk_t = R (*)(storage_t const&, Args&&...);
+
+    static method_delegate bind(IMethodInvoker const &invoker);
+
+    template<typename Self, typename ...Rest>
+    void bind_method(method_target const &target, std::vector<MetaType_ID> const &params) noexcept;
+
+    template<typename F>
+    void assign(void const *function) noexcept;
+
+    template<typename F>
+    static R call(storage_t const &storage, Args&&... args);
+
+    storage_t m_storage = {};
+    thunk_t m_thunk = nullptr;
+
+    friend class rtti::MetaMethod;
+};
+
 class MetaMethodPrivate;
 
 class RTTI_API MetaMethod final: public MetaItem
@@ -717,6 +982,12 @@ public:
 
     template<typename ...Args>
     variant invoke(Args&&... args) const;
+    // Instance of non static method is passed as first argument
+    variant invokeArgs(span<variant_ref const> args, void *result = nullptr) const;
+
+    // Throws invoke_error if signature doesn't match registered function exactly
+    template<typename Signature>
+    method_delegate<Signature> bind() const;
 protected:
     explicit MetaMethod(std::string_view name, MetaContainer &owner,
                         std::unique_ptr<IMethodInvoker> invoker);
@@ -725,6 +996,10 @@ protected:
 private:
     IMethodInvoker const* invoker() const;
 
+    template<typename I, typename ...Args>
+    static variant invoke_method(IMethodInvoker const *interface, I &&instance, Args&&... args);
+    variant invoke_method(IMethodInvoker const *interface) const;
+
     DECLARE_ACCESS_KEY(CreateAccessKey)
         template<typename, typename> friend class rtti::meta_define;
     };
@@ -735,21 +1010,73 @@ public:
 
 };
 
+// Call site cache of method resolved by name for dynamic type of instance.
+// Last resolution is checked first, few more types are kept as fallback.
+// Handle isn't synchronized, it should be owned by single call site or thread.
+class RTTI_API method_handle final
+{
+public:
+    explicit method_handle(symbol name) noexcept
+        : m_name{name}
+    {}
+    explicit method_handle(std::string_view name)
+        : m_name{name}
+    {}
+
+    symbol name() const noexcept
+    { return m_name; }
+
+    // Throws runtime_error if method isn't found
+    MetaMethod const* method(variant const &instance)
+    {
+        auto typeId = instance.classInfo().typeId;
+        if (auto const &entry = m_cache[0]; entry.typeId == typeId && entry.valid())
+            return entry.method;
+        return resolve(instance, typeId);
+    }
+
+    template<typename ...Args>
+    variant invoke(variant &instance, Args&& ...args)
+    { return method(instance)->invoke(instance, std::forward<Args>(args)...); }
+    template<typename ...Args>
+    variant invoke(variant const &instance, Args&& ...args)
+    { return method(instance)->invoke(instance, std::forward<Args>(args)...); }
+
+private:
+    MetaMethod const* resolve(variant const &instance, MetaType_ID typeId);
+
+    struct entry_t
+    {
+        // Method is outdated once class or its bases got new definitions
+        bool valid() const noexcept
+        { return counter && counter->load(std::memory_order_acquire) == generation; }
+
+        MetaType_ID typeId;
+        MetaMethod const *method = nullptr;
+        std::atomic_size_t const *counter = nullptr;
+        std::size_t generation = 0;
+    };
+    static constexpr std::size_t CacheSize = 4;
+
+    symbol m_name;
+    std::array<entry_t, CacheSize> m_cache = {};
+};
+
 //--------------------------------------------------------------------------------------------------------------------------------
 // MetaProperty
 //--------------------------------------------------------------------------------------------------------------------------------
 
 struct RTTI_API IPropertyInvoker
 {
-    virtual bool isStatic() const                                       = 0;
-    virtual MetaType_ID typeId() const                                  = 0;
-    virtual bool readOnly() const                                       = 0;
-    virtual variant get_static() const                                  = 0;
-    virtual void set_static(argument arg) const                         = 0;
-    virtual variant get_field(variant const &instance) const            = 0;
-    virtual void set_field(variant &instance, argument arg) const       = 0;
-    virtual void set_field(variant const &instance, argument arg) const = 0;
-    virtual ~IPropertyInvoker()                                         = default;
+    virtual bool isStatic() const                                          = 0;
+    virtual MetaType_ID typeId() const                                     = 0;
+    virtual bool readOnly() const                                          = 0;
+    virtual variant get_static() const                                     = 0;
+    virtual void set_static(variant_ref arg) const                         = 0;
+    virtual variant get_field(variant const &instance) const               = 0;
+    virtual void set_field(variant &instance, variant_ref arg) const       = 0;
+    virtual void set_field(variant const &instance, variant_ref arg) const = 0;
+    virtual ~IPropertyInvoker()                                            = default;
 };
 
 class MetaPropertyPrivate;
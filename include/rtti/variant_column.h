@@ -0,0 +1,132 @@
+﻿#ifndef VARIANT_COLUMN_H
+#define VARIANT_COLUMN_H
+
+#include <rtti/variant.h>
+#include <rtti/span.h>
+
+namespace rtti {
+
+// Contiguous storage of values of single type. Elements are managed through
+// type function table and can be accessed as typed span or as variant per cell.
+class RTTI_API variant_column final
+{
+public:
+    template<typename T>
+    static variant_column create();
+
+    variant_column(variant_column const &other);
+    variant_column& operator=(variant_column const &other);
+    variant_column(variant_column &&other) noexcept;
+    variant_column& operator=(variant_column &&other) noexcept;
+    ~variant_column() noexcept;
+
+    MetaType type() const noexcept
+    { return m_type; }
+    std::size_t size() const noexcept
+    { return m_size; }
+    std::size_t capacity() const noexcept
+    { return m_capacity; }
+    bool empty() const noexcept
+    { return m_size == 0; }
+
+    void reserve(std::size_t count);
+    // New elements are default constructed
+    void resize(std::size_t count);
+    void clear() noexcept;
+
+    // Value of other type is converted, throws bad_variant_convert if it isn't possible
+    void push_back(variant const &value);
+
+    template<typename T,
+             typename = std::enable_if_t<!std::is_same_v<std::decay_t<T>, variant>>>
+    void push_back(T &&value);
+
+    void erase(std::size_t index);
+    void erase(std::size_t first, std::size_t last);
+
+    // Copy of element
+    variant value(std::size_t index) const;
+    // Reference to element without copy, invalidated by reallocation
+    variant ref(std::size_t index);
+    variant cref(std::size_t index) const;
+
+    void* data() noexcept
+    { return m_data; }
+    void const* data() const noexcept
+    { return m_data; }
+
+    // Throws bad_variant_cast if T isn't the column type
+    template<typename T>
+    span<T> values();
+    template<typename T>
+    span<T const> values() const;
+
+private:
+    using table_t = internal::variant_function_table const;
+
+    variant_column(MetaType type, table_t *value, table_t *ref, table_t *cref) noexcept;
+
+    void* at(std::size_t index) const noexcept
+    { return static_cast<char*>(m_data) + index * m_type.typeSize(); }
+    std::size_t grow(std::size_t count) const noexcept;
+    void reallocate(std::size_t capacity);
+    void checkType(MetaType_ID typeId) const;
+    void checkIndex(std::size_t index) const;
+
+    MetaType m_type;
+    table_t *m_value = nullptr;
+    table_t *m_ref = nullptr;
+    table_t *m_cref = nullptr;
+    void *m_data = nullptr;
+    std::size_t m_size = 0;
+    std::size_t m_capacity = 0;
+};
+
+template<typename T>
+variant_column variant_column::create()
+{
+    static_assert(std::is_same_v<T, std::decay_t<T>> && !std::is_void_v<T>,
+                  "Column type should be decayed");
+
+    return variant_column{metaType<T>(),
+                          internal::variant_function_table_for<T>(),
+                          internal::variant_function_table_for<std::reference_wrapper<T>>(),
+                          internal::variant_function_table_for<std::reference_wrapper<T const>>()};
+}
+
+template<typename T, typename>
+void variant_column::push_back(T &&value)
+{
+    using U = std::remove_cv_t<std::remove_reference_t<T>>;
+    if (metaTypeId<U>() != m_type.typeId())
+        return push_back(variant{std::forward<T>(value)});
+
+    if (m_size == m_capacity)
+    {
+        // Value may refer to element of this column
+        U copy(std::forward<T>(value));
+        reserve(grow(m_size + 1));
+        new (at(m_size)) U(std::move(copy));
+    }
+    else
+        new (at(m_size)) U(std::forward<T>(value));
+    ++m_size;
+}
+
+template<typename T>
+span<T> variant_column::values()
+{
+    checkType(metaTypeId<std::remove_cv_t<T>>());
+    return {static_cast<T*>(m_data), m_size};
+}
+
+template<typename T>
+span<T const> variant_column::values() const
+{
+    checkType(metaTypeId<std::remove_cv_t<T>>());
+    return {static_cast<T const*>(m_data), m_size};
+}
+
+} // namespace rtti
+
+#endif // VARIANT_COLUMN_H
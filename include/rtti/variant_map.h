@@ -0,0 +1,200 @@
+﻿#ifndef VARIANT_MAP_H
+#define VARIANT_MAP_H
+
+#include <rtti/variant.h>
+
+#include <limits>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace rtti {
+
+// Open addressing hash map keyed by variant. Linear probing with backward shift
+// deletion, capacity is power of two and load factor is kept below 7/8.
+template<typename V>
+class variant_map final
+{
+public:
+    using key_type = variant;
+    using mapped_type = V;
+
+    variant_map() = default;
+    explicit variant_map(std::size_t count)
+    { reserve(count); }
+
+    std::size_t size() const noexcept
+    { return m_size; }
+    bool empty() const noexcept
+    { return m_size == 0; }
+    std::size_t capacity() const noexcept
+    { return m_slots.size(); }
+
+    void clear() noexcept
+    {
+        for (auto &slot: m_slots)
+            slot.reset();
+        m_size = 0;
+    }
+
+    void reserve(std::size_t count)
+    {
+        auto capacity = std::size_t{MinCapacity};
+        while (capacity * 7 < count * 8)
+            capacity *= 2;
+        if (capacity > m_slots.size())
+            rehash(capacity);
+    }
+
+    V* find(variant const &key)
+    { return const_cast<V*>(std::as_const(*this).find(key)); }
+
+    V const* find(variant const &key) const
+    {
+        auto index = lookup(key, key.hash());
+        return (index != npos) ? &m_slots[index]->value : nullptr;
+    }
+
+    // Lookup by plain value doesn't copy it into variant
+    template<typename K>
+    V* find(K const &key)
+    { return find(variant{std::cref(key)}); }
+
+    template<typename K>
+    V const* find(K const &key) const
+    { return find(variant{std::cref(key)}); }
+
+    template<typename K>
+    bool contains(K const &key) const
+    { return find(key) != nullptr; }
+
+    template<typename ...Args>
+    std::pair<V*, bool> try_emplace(variant key, Args &&...args)
+    {
+        auto hash = key.hash();
+        if (auto index = lookup(key, hash); index != npos)
+            return {&m_slots[index]->value, false};
+
+        if ((m_size + 1) * 8 > m_slots.size() * 7)
+            rehash(m_slots.empty() ? std::size_t{MinCapacity} : m_slots.size() * 2);
+
+        auto &slot = m_slots[vacant(hash)];
+        slot.emplace(Entry{hash, std::move(key), V(std::forward<Args>(args)...)});
+        ++m_size;
+        return {&slot->value, true};
+    }
+
+    template<typename M>
+    std::pair<V*, bool> insert_or_assign(variant key, M &&value)
+    {
+        auto result = try_emplace(std::move(key), std::forward<M>(value));
+        if (!result.second)
+            *result.first = std::forward<M>(value);
+        return result;
+    }
+
+    V& operator[](variant key)
+    { return *try_emplace(std::move(key)).first; }
+
+    bool erase(variant const &key)
+    {
+        auto index = lookup(key, key.hash());
+        if (index == npos)
+            return false;
+
+        auto mask = m_slots.size() - 1;
+        for (auto next = (index + 1) & mask; m_slots[next]; next = (next + 1) & mask)
+        {
+            // Shift back entries which probe sequence passes through the hole
+            auto ideal = position(m_slots[next]->hash);
+            if (((next - ideal) & mask) >= ((next - index) & mask))
+            {
+                m_slots[index].emplace(std::move(*m_slots[next]));
+                index = next;
+            }
+        }
+        m_slots[index].reset();
+        --m_size;
+        return true;
+    }
+
+    template<typename F>
+    void for_each(F &&func) const
+    {
+        for (auto &slot: m_slots)
+            if (slot && !func(std::as_const(slot->key), std::as_const(slot->value)))
+                return;
+    }
+
+    template<typename F>
+    void for_each(F &&func)
+    {
+        for (auto &slot: m_slots)
+            if (slot && !func(std::as_const(slot->key), slot->value))
+                return;
+    }
+
+private:
+    struct Entry
+    {
+        std::size_t hash;
+        variant key;
+        V value;
+    };
+
+    static constexpr std::size_t MinCapacity = 8;
+    static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+    // Fibonacci hashing spreads identity hashes of integers over the table
+    std::size_t position(std::size_t hash) const noexcept
+    {
+        constexpr auto multiplier = static_cast<std::size_t>(0x9E3779B97F4A7C15ull);
+        return (hash * multiplier) >> m_shift;
+    }
+
+    std::size_t lookup(variant const &key, std::size_t hash) const
+    {
+        if (m_slots.empty())
+            return npos;
+
+        auto mask = m_slots.size() - 1;
+        for (auto index = position(hash); m_slots[index]; index = (index + 1) & mask)
+        {
+            auto const &entry = *m_slots[index];
+            if (entry.hash == hash && entry.key == key)
+                return index;
+        }
+        return npos;
+    }
+
+    std::size_t vacant(std::size_t hash) const noexcept
+    {
+        auto mask = m_slots.size() - 1;
+        auto index = position(hash);
+        while (m_slots[index])
+            index = (index + 1) & mask;
+        return index;
+    }
+
+    void rehash(std::size_t capacity)
+    {
+        auto slots = std::vector<std::optional<Entry>>(capacity);
+        std::swap(slots, m_slots);
+
+        m_shift = std::numeric_limits<std::size_t>::digits;
+        for (auto i = capacity; i > 1; i /= 2)
+            --m_shift;
+
+        for (auto &slot: slots)
+            if (slot)
+                m_slots[vacant(slot->hash)].emplace(std::move(*slot));
+    }
+
+    std::vector<std::optional<Entry>> m_slots;
+    std::size_t m_size = 0;
+    unsigned m_shift = std::numeric_limits<std::size_t>::digits;
+};
+
+} // namespace rtti
+
+#endif // VARIANT_MAP_H
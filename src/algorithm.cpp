@@ -0,0 +1,249 @@
+﻿#include "variant_p.h"
+
+#include <rtti/algorithm.h>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <numeric>
+#include <thread>
+
+namespace rtti {
+
+namespace {
+
+using internal::variant_access;
+
+struct Run
+{
+    std::size_t first;
+    std::size_t last;
+    MetaType type;
+};
+
+template<typename Order>
+void permute(std::vector<variant> &values, std::size_t first, Order const &order)
+{
+    std::vector<variant> result;
+    result.reserve(order.size());
+    for (auto index: order)
+        result.push_back(std::move(values[index]));
+    std::move(result.begin(), result.end(), values.begin() + static_cast<std::ptrdiff_t>(first));
+}
+
+// Stable grouping by type index, empty values go first
+std::vector<Run> groupByType(std::vector<variant> &values)
+{
+    auto count = values.size();
+    std::vector<std::uint32_t> keys(count);
+    for (std::size_t i = 0; i < count; ++i)
+        keys[i] = values[i].empty() ? 0 : variant_access::decayType(values[i]).index();
+
+    if (!std::is_sorted(keys.begin(), keys.end()))
+    {
+        std::vector<std::size_t> order(count);
+        std::iota(order.begin(), order.end(), std::size_t{0});
+        std::stable_sort(order.begin(), order.end(), [&keys](auto lhs, auto rhs)
+        {
+            return keys[lhs] < keys[rhs];
+        });
+        permute(values, 0, order);
+        std::sort(keys.begin(), keys.end());
+    }
+
+    std::vector<Run> result;
+    for (std::size_t first = 0; first < count;)
+    {
+        auto last = first + 1;
+        while (last < count && keys[last] == keys[first])
+            ++last;
+        result.push_back({first, last, MetaType::fromIndex(keys[first])});
+        first = last;
+    }
+    return result;
+}
+
+using Item = std::pair<void const*, std::size_t>;
+
+// Runs longer than this are split between threads
+constexpr std::size_t ChunkSize = 8192;
+
+bool sortable(Run const &run)
+{
+    return (run.last - run.first > 1 && run.type.isLtComparable());
+}
+
+std::vector<Item> items(std::vector<variant> const &values, Run const &run)
+{
+    std::vector<Item> result;
+    result.reserve(run.last - run.first);
+    for (auto i = run.first; i < run.last; ++i)
+        result.emplace_back(variant_access::data(values[i]), i);
+    return result;
+}
+
+auto itemLess(MetaType type)
+{
+    return [type](Item const &lhs, Item const &rhs)
+    {
+        return type.less(lhs.first, rhs.first);
+    };
+}
+
+void apply(std::vector<variant> &values, Run const &run, std::vector<Item> const &items)
+{
+    std::vector<std::size_t> order;
+    order.reserve(items.size());
+    for (auto const &item: items)
+        order.push_back(item.second);
+    permute(values, run.first, order);
+}
+
+void sortRun(std::vector<variant> &values, Run const &run)
+{
+    if (!sortable(run))
+        return;
+
+    auto list = items(values, run);
+    std::stable_sort(list.begin(), list.end(), itemLess(run.type));
+    apply(values, run, list);
+}
+
+// Calls func for every index in [0, count) from at most threads threads,
+// first exception thrown by func is rethrown after all threads are joined
+template<typename F>
+void parallelFor(std::size_t threads, std::size_t count, F const &func)
+{
+    threads = std::min(threads, count);
+    if (threads < 2)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            func(i);
+        return;
+    }
+
+    std::atomic<std::size_t> next = 0;
+    std::exception_ptr error;
+    std::mutex lock;
+    auto worker = [&]
+    {
+        try
+        {
+            for (auto index = next++; index < count; index = next++)
+                func(index);
+        }
+        catch (...)
+        {
+            std::lock_guard guard{lock};
+            if (!error)
+                error = std::current_exception();
+            next = count;
+        }
+    };
+
+    std::vector<std::thread> pool;
+    try
+    {
+        pool.reserve(threads - 1);
+        for (std::size_t i = 1; i < threads; ++i)
+            pool.emplace_back(worker);
+    }
+    catch (...)
+    {
+        // Threads already started and this one finish the work
+    }
+    worker();
+    for (auto &thread: pool)
+        thread.join();
+
+    if (error)
+        std::rethrow_exception(error);
+}
+
+} // namespace
+
+void sort(std::vector<variant> &values)
+{
+    for (auto const &run: groupByType(values))
+        sortRun(values, run);
+}
+
+void sort(parallel_policy policy, std::vector<variant> &values)
+{
+    std::size_t threads = policy.threads ? policy.threads : std::thread::hardware_concurrency();
+    auto runs = groupByType(values);
+    if (threads < 2)
+    {
+        for (auto const &run: runs)
+            sortRun(values, run);
+        return;
+    }
+
+    struct Job
+    {
+        Run run;
+        std::vector<Item> items;
+        std::size_t width; // length of sorted chunks
+    };
+
+    std::vector<Job> jobs;
+    for (auto const &run: runs)
+        if (sortable(run))
+        {
+            auto size = run.last - run.first;
+            jobs.push_back({run, {}, std::max(ChunkSize, (size + threads - 1) / threads)});
+        }
+
+    parallelFor(threads, jobs.size(), [&values, &jobs](std::size_t index)
+    {
+        jobs[index].items = items(values, jobs[index].run);
+    });
+
+    // (job, chunk offset) pairs
+    std::vector<std::pair<std::size_t, std::size_t>> tasks;
+    for (std::size_t i = 0; i < jobs.size(); ++i)
+        for (std::size_t offset = 0; offset < jobs[i].items.size(); offset += jobs[i].width)
+            tasks.emplace_back(i, offset);
+
+    parallelFor(threads, tasks.size(), [&jobs, &tasks](std::size_t index)
+    {
+        auto &job = jobs[tasks[index].first];
+        auto first = job.items.begin() + static_cast<std::ptrdiff_t>(tasks[index].second);
+        auto last = job.items.begin() + static_cast<std::ptrdiff_t>(
+                    std::min(tasks[index].second + job.width, job.items.size()));
+        std::stable_sort(first, last, itemLess(job.run.type));
+    });
+
+    // Adjacent chunks are merged pairwise until every run is a single chunk
+    for (;;)
+    {
+        tasks.clear();
+        for (std::size_t i = 0; i < jobs.size(); ++i)
+            for (std::size_t offset = 0; offset + jobs[i].width < jobs[i].items.size(); offset += 2 * jobs[i].width)
+                tasks.emplace_back(i, offset);
+        if (tasks.empty())
+            break;
+
+        parallelFor(threads, tasks.size(), [&jobs, &tasks](std::size_t index)
+        {
+            auto &job = jobs[tasks[index].first];
+            auto offset = tasks[index].second;
+            auto first = job.items.begin() + static_cast<std::ptrdiff_t>(offset);
+            auto middle = first + static_cast<std::ptrdiff_t>(job.width);
+            auto last = job.items.begin() + static_cast<std::ptrdiff_t>(
+                        std::min(offset + 2 * job.width, job.items.size()));
+            std::inplace_merge(first, middle, last, itemLess(job.run.type));
+        });
+
+        for (auto &job: jobs)
+            job.width *= 2;
+    }
+
+    parallelFor(threads, jobs.size(), [&values, &jobs](std::size_t index)
+    {
+        apply(values, jobs[index].run, jobs[index].items);
+    });
+}
+
+} // namespace rtti
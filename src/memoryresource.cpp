@@ -0,0 +1,354 @@
+﻿#include <rtti/memoryresource.h>
+
+#include <atomic>
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace rtti {
+
+//--------------------------------------------------------------------------------------------------------------------------------
+// NewDeleteResource
+//--------------------------------------------------------------------------------------------------------------------------------
+
+namespace {
+
+class RTTI_PRIVATE NewDeleteResource final: public MemoryResource
+{
+protected:
+    void* do_allocate(std::size_t size, std::size_t align) override
+    {
+        if (align > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            return ::operator new(size, std::align_val_t{align});
+        return ::operator new(size);
+    }
+
+    void do_deallocate(void *ptr, std::size_t, std::size_t align) noexcept override
+    {
+        if (align > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            ::operator delete(ptr, std::align_val_t{align});
+        else
+            ::operator delete(ptr);
+    }
+};
+
+} // namespace
+
+// Resources are never destroyed, static variants may release memory after them
+MemoryResource* newDeleteResource() noexcept
+{
+    static auto *result = new NewDeleteResource;
+    return result;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------------
+// PoolResource
+//--------------------------------------------------------------------------------------------------------------------------------
+
+namespace {
+
+// Size classes are powers of two from 16 bytes to 4 KiB
+constexpr std::size_t MinClassShift = 4;
+constexpr std::size_t ClassCount = 9;
+constexpr std::size_t MaxPooled = std::size_t{1} << (MinClassShift + ClassCount - 1);
+// Slabs are aligned by their size, so owner of a block is found by masking its address
+constexpr std::size_t SlabSize = 64 * 1024;
+
+inline std::size_t sizeClass(std::size_t size, std::size_t align) noexcept
+{
+    auto bytes = std::max(size, align);
+    std::size_t result = 0;
+    while ((std::size_t{1} << (MinClassShift + result)) < bytes)
+        ++result;
+    return result;
+}
+
+inline std::size_t classSize(std::size_t index) noexcept
+{
+    return std::size_t{1} << (MinClassShift + index);
+}
+
+struct FreeNode
+{
+    FreeNode *next;
+};
+
+class ThreadPool;
+
+struct SlabHeader
+{
+    ThreadPool *owner;
+};
+
+class RTTI_PRIVATE ThreadPool
+{
+public:
+    ThreadPool() = default;
+    ThreadPool(ThreadPool const&) = delete;
+    ThreadPool& operator=(ThreadPool const&) = delete;
+
+    ~ThreadPool()
+    {
+        for (auto *slab: m_slabs)
+            ::operator delete(slab, std::align_val_t{SlabSize});
+    }
+
+    static ThreadPool* owner(void *ptr) noexcept
+    {
+        auto address = reinterpret_cast<std::uintptr_t>(ptr) & ~(std::uintptr_t{SlabSize} - 1);
+        return reinterpret_cast<SlabHeader*>(address)->owner;
+    }
+
+    void* allocate(std::size_t index)
+    {
+        auto &head = m_free[index];
+        if (!head)
+            reclaim(index);
+        if (!head)
+            refill(index);
+
+        auto *node = head;
+        head = node->next;
+        return node;
+    }
+
+    // Called by owner thread
+    void deallocate(void *ptr, std::size_t index) noexcept
+    {
+        auto *node = static_cast<FreeNode*>(ptr);
+        node->next = m_free[index];
+        m_free[index] = node;
+    }
+
+    // Called by any other thread, owner drains the list on allocation
+    void deallocateRemote(void *ptr, std::size_t index) noexcept
+    {
+        auto *node = static_cast<FreeNode*>(ptr);
+        auto &head = m_remote[index];
+        node->next = head.load(std::memory_order_relaxed);
+        while (!head.compare_exchange_weak(node->next, node,
+                                           std::memory_order_release,
+                                           std::memory_order_relaxed))
+        {}
+    }
+
+private:
+    void reclaim(std::size_t index) noexcept
+    {
+        m_free[index] = m_remote[index].exchange(nullptr, std::memory_order_acquire);
+    }
+
+    void refill(std::size_t index)
+    {
+        auto *slab = static_cast<char*>(::operator new(SlabSize, std::align_val_t{SlabSize}));
+        m_slabs.push_back(slab);
+        new (slab) SlabHeader{this};
+
+        auto size = classSize(index);
+        auto offset = (sizeof(SlabHeader) + size - 1) & ~(size - 1);
+        for (auto pos = SlabSize - size; pos >= offset; pos -= size)
+        {
+            deallocate(slab + pos, index);
+            if (pos == offset)
+                break;
+        }
+    }
+
+    FreeNode *m_free[ClassCount] = {};
+    std::atomic<FreeNode*> m_remote[ClassCount] = {};
+    std::vector<void*> m_slabs;
+};
+
+// Pools outlive their threads: block allocated by one thread may be freed
+// by any other at any time, so pool of finished thread is adopted by next one.
+class RTTI_PRIVATE PoolRegistry
+{
+public:
+    ThreadPool* acquire()
+    {
+        std::lock_guard lock{m_lock};
+        if (!m_orphans.empty())
+        {
+            auto *result = m_orphans.back();
+            m_orphans.pop_back();
+            return result;
+        }
+        return m_pools.emplace_back(new ThreadPool).get();
+    }
+
+    void release(ThreadPool *pool)
+    {
+        std::lock_guard lock{m_lock};
+        m_orphans.push_back(pool);
+    }
+
+    // Allocation from thread_local destructors after the pool was handed back,
+    // such threads share one pool, so their blocks are freed only as remote ones
+    void* allocateAfterExit(std::size_t index)
+    {
+        std::lock_guard lock{m_exitLock};
+        if (!m_exitPool)
+            m_exitPool = acquire();
+        return m_exitPool->allocate(index);
+    }
+
+private:
+    std::mutex m_lock;
+    std::mutex m_exitLock;
+    ThreadPool *m_exitPool = nullptr;
+    std::vector<std::unique_ptr<ThreadPool>> m_pools;
+    std::vector<ThreadPool*> m_orphans;
+};
+
+// Intentionally never destroyed, blocks may be freed during static destruction
+PoolRegistry* poolRegistry()
+{
+    static auto *result = new PoolRegistry;
+    return result;
+}
+
+// Plain pointer keeps the hot path free of thread_local init guards,
+// holder is touched once per thread to hand the pool back on exit
+thread_local ThreadPool *t_pool = nullptr;
+thread_local bool t_exited = false;
+
+struct ThreadPoolHolder
+{
+    ~ThreadPoolHolder()
+    {
+        poolRegistry()->release(pool);
+        t_pool = nullptr;
+        t_exited = true;
+    }
+
+    ThreadPool *pool;
+};
+
+// Null once the thread has handed its pool back
+ThreadPool* currentPool()
+{
+    if (!t_pool && !t_exited)
+    {
+        thread_local ThreadPoolHolder holder{poolRegistry()->acquire()};
+        t_pool = holder.pool;
+    }
+    return t_pool;
+}
+
+class RTTI_PRIVATE PoolResource final: public MemoryResource
+{
+protected:
+    void* do_allocate(std::size_t size, std::size_t align) override
+    {
+        if (size > MaxPooled || align > MaxPooled)
+            return newDeleteResource()->allocate(size, align);
+
+        auto index = sizeClass(size, align);
+        if (auto *pool = currentPool())
+            return pool->allocate(index);
+        return poolRegistry()->allocateAfterExit(index);
+    }
+
+    void do_deallocate(void *ptr, std::size_t size, std::size_t align) noexcept override
+    {
+        if (!ptr)
+            return;
+
+        if (size > MaxPooled || align > MaxPooled)
+            return newDeleteResource()->deallocate(ptr, size, align);
+
+        auto index = sizeClass(size, align);
+        auto *owner = ThreadPool::owner(ptr);
+        if (owner == t_pool)
+            owner->deallocate(ptr, index);
+        else
+            owner->deallocateRemote(ptr, index);
+    }
+};
+
+} // namespace
+
+MemoryResource* poolResource() noexcept
+{
+    static auto *result = new PoolResource;
+    return result;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------------
+// ArenaResource
+//--------------------------------------------------------------------------------------------------------------------------------
+
+namespace {
+
+constexpr std::size_t MaxArenaBlock = 1024 * 1024;
+
+} // namespace
+
+struct ArenaResource::Block
+{
+    Block *next;
+    std::size_t size;
+};
+
+ArenaResource::ArenaResource(std::size_t blockSize, MemoryResource *upstream) noexcept
+    : m_upstream{upstream ? upstream : newDeleteResource()}
+    , m_blockSize{std::max(blockSize, 2 * sizeof(Block))}
+{}
+
+ArenaResource::~ArenaResource()
+{
+    release();
+}
+
+void ArenaResource::release() noexcept
+{
+    while (m_blocks)
+    {
+        auto *block = m_blocks;
+        m_blocks = block->next;
+        m_upstream->deallocate(block, block->size, alignof(std::max_align_t));
+    }
+    m_current = m_end = nullptr;
+}
+
+void* ArenaResource::do_allocate(std::size_t size, std::size_t align)
+{
+    align = std::max(align, std::size_t{1});
+    auto padding = [align](char *ptr) -> std::size_t
+    {
+        auto address = reinterpret_cast<std::uintptr_t>(ptr);
+        return (align - address % align) % align;
+    };
+
+    // Sizes are compared, pointer past the end of block is never formed
+    if (m_current)
+    {
+        auto available = static_cast<std::size_t>(m_end - m_current);
+        if (auto offset = padding(m_current); offset <= available && size <= available - offset)
+        {
+            auto *result = m_current + offset;
+            m_current = result + size;
+            return result;
+        }
+    }
+
+    // Blocks grow geometrically, oversized request gets its own block
+    auto bytes = std::max(m_blockSize, sizeof(Block) + size + align);
+    auto *raw = static_cast<char*>(m_upstream->allocate(bytes, alignof(std::max_align_t)));
+    m_blocks = new (raw) Block{m_blocks, bytes};
+    if (m_blockSize < MaxArenaBlock)
+        m_blockSize *= 2;
+
+    auto *result = raw + sizeof(Block) + padding(raw + sizeof(Block));
+    m_current = result + size;
+    m_end = raw + bytes;
+    return result;
+}
+
+void ArenaResource::do_deallocate(void*, std::size_t, std::size_t) noexcept
+{}
+
+} // namespace rtti
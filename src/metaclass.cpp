@@ -6,6 +6,178 @@
 
 namespace rtti {
 
+//--------------------------------------------------------------------------------------------------------------------------------
+// MetaClassPrivate
+//--------------------------------------------------------------------------------------------------------------------------------
+
+void MetaClassPrivate::definitionChanged() const
+{
+    m_definitionGeneration.fetch_add(1, std::memory_order_acq_rel);
+    m_derivedClasses.for_each([](MetaType_ID typeId)
+    {
+        auto derived = MetaClass::find(typeId);
+        assert(derived);
+        derived->d_func()->definitionChanged();
+    });
+}
+
+internal::MemberTable const* MetaClassPrivate::memberTable(MetaClass const &self,
+                                                           internal::ReadGuard const &guard) const
+{
+    auto generation = definitionGeneration();
+    auto result = m_memberTable.get(guard);
+    if (result && result->generation == generation)
+        return result;
+
+    auto table = std::make_unique<internal::MemberTable>();
+    table->generation = generation;
+    if (!collectMembers(self, *table))
+        return nullptr;
+    return m_memberTable.publish(std::move(table), guard);
+}
+
+// False while class or one of its bases is still running deferred definition
+bool MetaClassPrivate::collectMembers(MetaClass const &self, internal::MemberTable &table) const
+{
+    self.checkDeferredDefine();
+    if (!defined())
+        return false;
+
+    for_each(mcatMethod, [&table](MetaItem const *item)
+    {
+        auto method = static_cast<MetaMethod const*>(item);
+        auto name = std::string_view{method->name()};
+        auto bare = name.substr(0, name.find('('));
+        table.methods.emplace(name, method);
+        table.methods.emplace(bare, method);
+        table.methodSymbols.emplace(symbol{name}.id(), method);
+        table.methodSymbols.emplace(symbol{bare}.id(), method);
+        return true;
+    });
+
+    for_each(mcatProperty, [&table](MetaItem const *item)
+    {
+        auto property = static_cast<MetaProperty const*>(item);
+        table.properties.emplace(property->name(), property);
+        table.propertySymbols.emplace(symbol{property->name()}.id(), property);
+        return true;
+    });
+
+    auto result = true;
+    m_baseClasses.for_each([&table, &result](auto const &item)
+    {
+        auto directBase = MetaClass::find(item.typeId);
+        assert(directBase);
+        result = directBase->d_func()->collectMembers(*directBase, table);
+        return result;
+    });
+    return result;
+}
+
+void MetaClassPrivate::hierarchyChanged() const
+{
+    m_hierarchyGeneration.fetch_add(1, std::memory_order_acq_rel);
+    m_derivedClasses.for_each([](MetaType_ID typeId)
+    {
+        auto derived = MetaClass::find(typeId);
+        assert(derived);
+        derived->d_func()->hierarchyChanged();
+    });
+}
+
+internal::AncestorTable const* MetaClassPrivate::ancestorTable(MetaClass const &self,
+                                                               internal::ReadGuard const &guard) const
+{
+    using item_t = internal::BaseClassList::item_t;
+
+    self.checkDeferredDefine();
+    auto generation = hierarchyGeneration();
+    auto result = m_ancestorTable.get(guard);
+    if (result && result->generation == generation)
+        return result;
+
+    auto table = std::make_unique<internal::AncestorTable>();
+    table->generation = generation;
+    table->insert(m_index);
+    table->paths[m_index].offset = 0;
+    m_baseClasses.for_each([&table, &guard](item_t const &item)
+    {
+        auto directBase = MetaClass::find(item.typeId);
+        assert(directBase);
+        auto baseTable = directBase->d_func()->ancestorTable(*directBase, guard);
+        for (auto const &[index, path]: baseTable->paths)
+        {
+            // ancestor reachable through preceding base
+            if (table->contains(index))
+                continue;
+            table->insert(index);
+            auto &composed = table->paths[index];
+            composed.casters.reserve(path.casters.size() + 1);
+            composed.casters.push_back(item.caster);
+            composed.casters.insert(std::end(composed.casters),
+                                    std::begin(path.casters), std::end(path.casters));
+            composed.hasVirtualBase = (item.isVirtual || path.hasVirtualBase);
+        }
+        return true;
+    });
+
+    return m_ancestorTable.publish(std::move(table), guard);
+}
+
+template<typename Name>
+MetaMethod const* MetaClassPrivate::lookupMethod(MetaClass const &self, Name name) const
+{
+    using item_t = internal::BaseClassList::item_t;
+
+    if (name.empty())
+        return nullptr;
+
+    self.checkDeferredDefine();
+    internal::ReadGuard guard;
+    if (auto table = memberTable(self, guard))
+        return table->method(name);
+
+    if (auto result = self.MetaContainer::getMethodInternal(name))
+        return result;
+
+    MetaMethod const *result = nullptr;
+    m_baseClasses.for_each([&result, name](item_t const &item)
+    {
+        auto directBase = MetaClass::find(item.typeId);
+        assert(directBase);
+        result = directBase->getMethodInternal(name);
+        return !result;
+    });
+    return result;
+}
+
+template<typename Name>
+MetaProperty const* MetaClassPrivate::lookupProperty(MetaClass const &self, Name name) const
+{
+    using item_t = internal::BaseClassList::item_t;
+
+    if (name.empty())
+        return nullptr;
+
+    self.checkDeferredDefine();
+    internal::ReadGuard guard;
+    if (auto table = memberTable(self, guard))
+        return table->property(name);
+
+    if (auto result = self.MetaContainer::getPropertyInternal(name))
+        return result;
+
+    MetaProperty const *result = nullptr;
+    m_baseClasses.for_each([&result, name](item_t const &item)
+    {
+        auto directBase = MetaClass::find(item.typeId);
+        assert(directBase);
+        result = directBase->getPropertyInternal(name);
+        return !result;
+    });
+    return result;
+}
+
 //--------------------------------------------------------------------------------------------------------------------------------
 // MetaClass
 //--------------------------------------------------------------------------------------------------------------------------------
@@ -89,7 +261,7 @@ MetaClass const* MetaClass::derivedClass(std::size_t index) const
     return find(typeId);
 }
 
-void MetaClass::addBaseClass(MetaType_ID typeId, cast_func_t caster)
+void MetaClass::addBaseClass(MetaType_ID typeId, cast_func_t caster, bool isVirtual)
 {
     using namespace std::literals;
 
@@ -101,8 +273,10 @@ void MetaClass::addBaseClass(MetaType_ID typeId, cast_func_t caster)
         throw unregistered_metaclass{"Base class "s + type.typeName() + " not registered"};
 
     auto d = d_func();
-    d->m_baseClasses.add(typeId, caster);
+    d->m_baseClasses.add(typeId, caster, isVirtual);
     base->addDerivedClass(d->m_typeId);
+    d->definitionChanged();
+    d->hierarchyChanged();
 }
 
 void MetaClass::addDerivedClass(MetaType_ID typeId)
@@ -120,6 +294,18 @@ void MetaClass::addDerivedClass(MetaType_ID typeId)
     d->m_derivedClasses.add(typeId);
 }
 
+std::size_t MetaClass::definitionGeneration() const noexcept
+{
+    auto d = d_func();
+    return d->definitionGeneration();
+}
+
+std::atomic_size_t const& MetaClass::definitionCounter() const noexcept
+{
+    auto d = d_func();
+    return d->m_definitionGeneration;
+}
+
 bool MetaClass::inheritedFrom(MetaClass const *base) const
 {
     if (!base)
@@ -127,50 +313,38 @@ bool MetaClass::inheritedFrom(MetaClass const *base) const
     if (base == this)
         return true;
 
-    checkDeferredDefine();
-    auto d      = d_func();
-    auto result = false;
-    d->m_baseClasses.for_each([&result, base](auto const &item)
-    {
-        auto directBase = find(item.first);
-        assert(directBase);
-        if (directBase->inheritedFrom(base))
-        {
-            result = true;
-            return false;
-        }
-        return true;
-    });
-    return result;
+    auto d = d_func();
+    internal::ReadGuard guard;
+    return d->ancestorTable(*this, guard)->contains(base->d_func()->m_index);
 }
 
 void const* MetaClass::cast(MetaClass const *base, void const *instance) const
 {
-    if (!base)
+    if (!base || !instance)
         return nullptr;
-
-    auto result = instance;
     if (base == this)
-        return result;
+        return instance;
 
-    checkDeferredDefine();
-    auto d     = d_func();
-    auto found = false;
-    d->m_baseClasses.for_each([&result, base, &found](auto const &item)
-    {
-        auto directBase = find(item.first);
-        assert(directBase);
-        if (directBase->inheritedFrom(base))
-        {
-            // cast to direct base
-            result = directBase->cast(base, item.second(result));
-            found  = true;
-            return false;
-        }
-        return true;
-    });
+    auto d      = d_func();
+    internal::ReadGuard guard;
+    auto table  = d->ancestorTable(*this, guard);
+    auto search = table->paths.find(base->d_func()->m_index);
+    if (search == std::end(table->paths))
+        return nullptr;
 
-    return (found ? result : nullptr);
+    auto const &path = search->second;
+    auto offset = path.offset.load(std::memory_order_relaxed);
+    if (offset != internal::CastPath::UnknownOffset)
+        return static_cast<char const*>(instance) + offset;
+
+    // Offset of virtual base depends on dynamic type of instance
+    auto result = instance;
+    for (auto caster: path.casters)
+        result = caster(result);
+    if (!path.hasVirtualBase)
+        path.offset.store(static_cast<char const*>(result) - static_cast<char const*>(instance),
+                          std::memory_order_relaxed);
+    return result;
 }
 
 void* MetaClass::cast(MetaClass const *base, void *instance) const
@@ -180,58 +354,22 @@ void* MetaClass::cast(MetaClass const *base, void *instance) const
 
 MetaMethod const* MetaClass::getMethodInternal(std::string_view name) const
 {
-    using item_t = internal::BaseClassList::item_t;
-
-    if (name.empty())
-        return nullptr;
-
-    auto result = MetaContainer::getMethodInternal(name);
-    if (result)
-        return result;
+    return d_func()->lookupMethod(*this, name);
+}
 
-    auto d     = d_func();
-    auto found = false;
-    d->m_baseClasses.for_each([&result, &name, &found](item_t const &item)
-    {
-        auto directBase = find(item.first);
-        assert(directBase);
-        result = directBase->getMethodInternal(name);
-        if (result)
-        {
-            found = true;
-            return false;
-        }
-        return true;
-    });
-    return (found ? result : nullptr);
+MetaMethod const* MetaClass::getMethodInternal(symbol name) const
+{
+    return d_func()->lookupMethod(*this, name);
 }
 
 MetaProperty const* MetaClass::getPropertyInternal(std::string_view name) const
 {
-    using item_t = internal::BaseClassList::item_t;
-
-    if (name.empty())
-        return nullptr;
-
-    auto result = MetaContainer::getPropertyInternal(name);
-    if (result)
-        return result;
+    return d_func()->lookupProperty(*this, name);
+}
 
-    auto d     = d_func();
-    auto found = false;
-    d->m_baseClasses.for_each([&result, &name, &found](item_t const &item)
-    {
-        auto directBase = find(item.first);
-        assert(directBase);
-        result = directBase->getPropertyInternal(name);
-        if (result)
-        {
-            found = true;
-            return false;
-        }
-        return true;
-    });
-    return (found ? result : nullptr);
+MetaProperty const* MetaClass::getPropertyInternal(symbol name) const
+{
+    return d_func()->lookupProperty(*this, name);
 }
 
 MetaCategory MetaClass::category() const
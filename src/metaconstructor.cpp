@@ -38,4 +38,9 @@ MetaCategory MetaConstructor::category() const
     return mcatConstructor;
 }
 
+variant MetaConstructor::invokeArgs(span<variant_ref const> args, void *result) const
+{
+    return constructor()->invoke_static(args, result);
+}
+
 } // namespace rtti
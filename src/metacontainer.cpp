@@ -38,6 +38,13 @@ bool MetaItemList::add(MetaItem *value)
         auto index = m_items.size();
         m_items.emplace_back(value);
         m_names.emplace(name, index);
+        m_symbols.emplace(symbol{name}.id(), index);
+        if (auto pos = name.find('('); pos != std::string::npos)
+        {
+            auto bare = std::string_view{name}.substr(0, pos);
+            m_overloads[bare].push_back(index);
+            m_overloadSymbols.try_emplace(symbol{bare}.id(), index);
+        }
         return true;
     }
     return false;
@@ -64,6 +71,49 @@ inline MetaItem* MetaItemList::get(std::string_view name) const
     return nullptr;
 }
 
+inline MetaItem* MetaItemList::get(symbol name) const
+{
+    if (name.empty())
+        return nullptr;
+
+    std::shared_lock<std::shared_mutex> lock{m_lock};
+    if (auto it = m_symbols.find(name.id()); it != std::end(m_symbols))
+        return m_items[it->second].get();
+
+    return nullptr;
+}
+
+MetaItem* MetaItemList::find(std::string_view name) const
+{
+    if (name.empty())
+        return nullptr;
+
+    std::shared_lock<std::shared_mutex> lock{m_lock};
+    if (auto it = m_names.find(name); it != std::end(m_names))
+        return m_items[it->second].get();
+
+    if (name.find('(') == std::string_view::npos)
+        if (auto it = m_overloads.find(name); it != std::end(m_overloads))
+            return m_items[it->second.front()].get();
+
+    return nullptr;
+}
+
+MetaItem* MetaItemList::find(symbol name) const
+{
+    if (name.empty())
+        return nullptr;
+
+    std::shared_lock<std::shared_mutex> lock{m_lock};
+    if (auto it = m_symbols.find(name.id()); it != std::end(m_symbols))
+        return m_items[it->second].get();
+
+    if (auto it = m_overloadSymbols.find(name.id()); it != std::end(m_overloadSymbols))
+        return m_items[it->second].get();
+
+    return nullptr;
+}
+
 std::size_t MetaItemList::size() const
 {
     std::shared_lock<std::shared_mutex> lock{m_lock};
@@ -82,47 +132,21 @@ inline bool MetaContainerPrivate::addItem(MetaItem *value)
         return false;
 
     auto category = value->category();
-    return m_lists[category]->add(value);
+    if (!m_lists[category]->add(value))
+        return false;
+    if (category == mcatMethod || category == mcatProperty)
+        definitionChanged();
+    return true;
 }
 
 MetaItem* MetaContainerPrivate::findMethod(MetaCategory category, std::string_view name) const
 {
-    MetaItem *result = nullptr;
-    m_lists[category]->for_each([&name, &result](MetaItem *item) -> bool
-    {
-        auto const &methodName = item->name();
+    return m_lists[category]->find(name);
+}
 
-        if (auto pos = methodName.find('(');
-            pos != std::string::npos)
-        {
-            auto length = std::min(pos, name.size());
-            if (auto cmp = methodName.compare(0, pos, name, 0, length);
-                cmp == 0)
-            {
-                 if (pos == name.size())
-                 {
-                     result = item;
-                     return false;
-                 }
-
-                 cmp = methodName.compare(pos, methodName.size() - pos,
-                                          name, pos, name.size() - pos);
-                 if (cmp == 0)
-                 {
-                     result = item;
-                     return false;
-                 }
-            }
-        }
-        else if (auto cmp = methodName.compare(name);
-                 cmp == 0)
-        {
-            result = item;
-            return false;
-        }
-        return true;
-    });
-    return result;
+MetaItem* MetaContainerPrivate::findMethod(MetaCategory category, symbol name) const
+{
+    return m_lists[category]->find(name);
 }
 
 //--------------------------------------------------------------------------------------------------------------------------------
@@ -214,6 +238,13 @@ MetaItem const* MetaContainer::item(MetaCategory category, std::string_view name
     return d->item(category, name);
 }
 
+MetaItem const* MetaContainer::item(MetaCategory category, symbol name) const
+{
+    checkDeferredDefine();
+    auto d = d_func();
+    return d->item(category, name);
+}
+
 MetaItem const* MetaContainer::item(MetaCategory category, std::size_t index) const
 {
     checkDeferredDefine();
@@ -230,6 +261,11 @@ MetaNamespace const* MetaContainer::getNamespace(std::string_view name) const
     return static_cast<MetaNamespace const*>(item(mcatNamespace, name));
 }
 
+MetaNamespace const* MetaContainer::getNamespace(symbol name) const
+{
+    return static_cast<MetaNamespace const*>(item(mcatNamespace, name));
+}
+
 std::size_t MetaContainer::namespaceCount() const
 {
     return count(mcatNamespace);
@@ -249,6 +285,11 @@ MetaClass const* MetaContainer::getClass(std::string_view name) const
     return static_cast<MetaClass const*>(item(mcatClass, name));
 }
 
+MetaClass const* MetaContainer::getClass(symbol name) const
+{
+    return static_cast<MetaClass const*>(item(mcatClass, name));
+}
+
 std::size_t MetaContainer::classCount() const
 {
     return count(mcatClass);
@@ -325,6 +366,19 @@ MetaMethod const* MetaContainer::getMethod(std::string_view name) const
     return getMethodInternal(name);
 }
 
+MetaMethod const* MetaContainer::getMethodInternal(symbol name) const
+{
+    checkDeferredDefine();
+    return static_cast<MetaMethod const*>(d_func()->findMethod(mcatMethod, name));
+}
+
+MetaMethod const* MetaContainer::getMethod(symbol name) const
+{
+    if (name.empty())
+        return nullptr;
+    return getMethodInternal(name);
+}
+
 std::size_t MetaContainer::methodCount() const
 {
     return count(mcatMethod);
@@ -362,6 +416,16 @@ MetaProperty const* MetaContainer::getProperty(std::string_view name) const
     return getPropertyInternal(name);
 }
 
+MetaProperty const* MetaContainer::getPropertyInternal(symbol name) const
+{
+    return static_cast<MetaProperty const*>(item(mcatProperty, name));
+}
+
+MetaProperty const* MetaContainer::getProperty(symbol name) const
+{
+    return getPropertyInternal(name);
+}
+
 std::size_t MetaContainer::propertyCount() const
 {
     return count(mcatProperty);
@@ -381,6 +445,11 @@ MetaEnum const* MetaContainer::getEnum(std::string_view name) const
     return static_cast<MetaEnum const*>(item(mcatEnum, name));
 }
 
+MetaEnum const* MetaContainer::getEnum(symbol name) const
+{
+    return static_cast<MetaEnum const*>(item(mcatEnum, name));
+}
+
 std::size_t MetaContainer::enumCount() const
 {
     return count(mcatEnum);
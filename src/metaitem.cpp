@@ -30,6 +30,17 @@ namespace internal {
         return variant::empty_variant;
     }
 
+    variant const &NamedVariantList::get(symbol name) const
+    {
+        if (!name.empty())
+        {
+            std::shared_lock<std::shared_mutex> lock{m_lock};
+            if (auto search = m_symbols.find(name.id()); search != std::end(m_symbols))
+                return m_items[search->second]->value;
+        }
+        return variant::empty_variant;
+    }
+
     std::string const &NamedVariantList::name(std::size_t index) const
     {
         std::shared_lock<std::shared_mutex> lock{m_lock};
@@ -123,6 +134,13 @@ variant const& MetaItem::attribute(std::string_view name) const
     return d->m_attributes.get(name);
 }
 
+variant const& MetaItem::attribute(symbol name) const
+{
+    checkDeferredDefine();
+    auto d = d_func();
+    return d->m_attributes.get(name);
+}
+
 void MetaItem::for_each_attribute(enum_attribute_t const &func) const
 {
     if (!func)
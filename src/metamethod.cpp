@@ -1,6 +1,8 @@
 ﻿#include "metamethod_p.h"
 #include "metacontainer_p.h"
 
+#include <algorithm>
+
 namespace rtti {
 
 IMethodInvoker const* MetaMethod::invoker() const
@@ -14,6 +16,70 @@ MetaCategory MetaMethod::category() const
     return mcatMethod;
 }
 
+variant MetaMethod::invokeArgs(span<variant_ref const> args, void *result) const
+{
+    auto interface = invoker();
+    if (interface->isStatic())
+        return interface->invoke_static(args, result);
+
+    if (args.empty())
+        return invoke_method(interface);
+
+    auto &self = args.front();
+    auto rest = args.subspan(1, args.size() - 1);
+    if (auto *instance = self.data<variant>())
+        return interface->invoke_method(*instance, rest, result);
+    if (auto *instance = self.data<variant const>())
+        return interface->invoke_method(*instance, rest, result);
+
+    auto instance = self.get();
+    return interface->invoke_method(instance, rest, result);
+}
+
+MetaMethod const* method_handle::resolve(variant const &instance, MetaType_ID typeId)
+{
+    using namespace std::literals;
+
+    auto last = CacheSize - 1;
+    for (std::size_t i = 0; i < CacheSize && m_cache[i].method; ++i)
+    {
+        if (m_cache[i].typeId == typeId)
+        {
+            // most recent type goes first
+            std::rotate(std::begin(m_cache), std::begin(m_cache) + i, std::begin(m_cache) + i + 1);
+            if (m_cache[0].valid())
+                return m_cache[0].method;
+            last = 0;
+            break;
+        }
+    }
+
+    auto type = MetaType{instance.typeId()};
+    if (!type.isClass() && !type.isClassPtr())
+        throw runtime_error{"Type T = "s + type.typeName() + " isn't Class or ClassPtr"};
+
+    auto *mt_class = MetaClass::find(typeId);
+    if (!mt_class)
+        throw runtime_error{"Class T = "s + type.typeName() + " isn't registered"};
+
+    // Generation is taken before lookup, so definition added meanwhile isn't missed
+    auto const &counter = mt_class->definitionCounter();
+    auto generation = counter.load(std::memory_order_acquire);
+    auto *result = mt_class->getMethod(m_name);
+    if (!result)
+        throw runtime_error{"Method ["s + m_name.str() + "] isn't found in class T = " + type.typeName()};
+
+    // Outdated entry of this type is replaced in place, otherwise the oldest one is evicted
+    std::move_backward(std::begin(m_cache), std::begin(m_cache) + last, std::begin(m_cache) + last + 1);
+    m_cache[0] = {typeId, result, &counter, generation};
+    return result;
+}
+
+variant MetaMethod::invoke_method(IMethodInvoker const*) const
+{
+    throw invoke_error{"Instance is required to invoke method " + qualifiedName()};
+}
+
 MetaMethod::MetaMethod(std::string_view name, MetaContainer &owner,
                        std::unique_ptr<IMethodInvoker> invoker)
     : MetaItem(*new MetaMethodPrivate{name, owner, std::move(invoker)})
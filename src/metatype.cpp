@@ -2,18 +2,103 @@
 
 #include <rtti/metatype.h>
 #include <rtti/signature.h>
+#include <rtti/memoryresource.h>
 
 #include <ostream>
+#include <mutex>
 #include <shared_mutex>
 #include <forward_list>
 #include <unordered_map>
+#include <vector>
 #include <memory>
+#include <algorithm>
+#include <iterator>
 #include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <array>
+#include <tuple>
+#include <utility>
 
 namespace rtti {
 
 namespace {
 
+inline TypeInfo const* decayInfo(TypeInfo const *info)
+{
+    return reinterpret_cast<TypeInfo const*>(info->decay.value());
+}
+
+inline TypeInfo const* decayInfo(MetaType type)
+{
+    return reinterpret_cast<TypeInfo const*>(type.decayId().value());
+}
+
+// Immutable open-addressing name index published by CustomTypes once the
+// registry is sealed. Readers never lock, writers build a fresh copy.
+class RTTI_PRIVATE NameTable
+{
+public:
+    explicit NameTable(std::size_t count)
+    {
+        auto capacity = std::size_t{16};
+        while (capacity < count * 2)
+            capacity <<= 1;
+        m_slots.resize(capacity);
+        m_mask = capacity - 1;
+    }
+
+    void insert(TypeInfo const *info)
+    {
+        auto hash = std::hash<std::string_view>{}(info->name);
+        for (auto index = hash & m_mask;; index = (index + 1) & m_mask)
+        {
+            auto &slot = m_slots[index];
+            if (!slot.info)
+            {
+                slot.hash = hash;
+                slot.info = info;
+                return;
+            }
+        }
+    }
+
+    TypeInfo const* find(std::string_view name) const noexcept
+    {
+        auto hash = std::hash<std::string_view>{}(name);
+        for (auto index = hash & m_mask;; index = (index + 1) & m_mask)
+        {
+            auto const &slot = m_slots[index];
+            if (!slot.info)
+                return nullptr;
+            if (slot.hash == hash && slot.info->name == name)
+                return slot.info;
+        }
+    }
+
+private:
+    struct Slot
+    {
+        std::size_t hash = 0;
+        TypeInfo const *info = nullptr;
+    };
+
+    std::vector<Slot> m_slots;
+    std::size_t m_mask = 0;
+};
+
+// Index -> TypeInfo array, grown by copying so readers never lock.
+struct RTTI_PRIVATE IndexTable
+{
+    explicit IndexTable(std::uint32_t capacity)
+        : capacity{capacity}
+        , items{new TypeInfo const*[capacity]{}}
+    {}
+
+    std::uint32_t const capacity;
+    std::unique_ptr<TypeInfo const*[]> const items;
+};
+
 class RTTI_PRIVATE CustomTypes
 {
 public:
@@ -27,15 +112,34 @@ public:
     inline MetaType_ID getTypeId(TypeInfo const *type_info) const;
     inline TypeInfo const *getTypeInfo(MetaType_ID typeId) const;
     TypeInfo const *getTypeInfo(std::string_view name) const;
-    TypeInfo const *addTypeInfo(std::string_view name, std::size_t size, MetaType_ID decay,
+    inline TypeInfo const *getTypeInfo(std::uint32_t index) const;
+    inline std::uint32_t count() const;
+    TypeInfo const *addTypeInfo(std::string_view name, std::size_t size, std::size_t align, MetaType_ID decay,
                                 std::uint16_t arity, std::uint16_t const_mask, TypeFlags flags,
                                 metatype_manager_t const *manager);
+    void seal();
+    bool sealed() const noexcept;
 
 private:
+    void publish();
+
     mutable std::shared_mutex m_lock;
     std::forward_list<TypeInfo> m_items;
     std::unordered_map<std::string_view, TypeInfo const *> m_names;
 
+    // Published name index, null until sealed. Superseded tables are kept
+    // alive because lock-free readers may still be probing them.
+    std::atomic<NameTable const *> m_sealed = nullptr;
+    std::vector<std::unique_ptr<NameTable>> m_tables;
+    // Types registered after last snapshot are found in m_names under lock.
+    // Snapshot is rebuilt when they outnumber it, so retained tables stay O(N) in total.
+    std::atomic<std::size_t> m_lateCount = 0;
+    std::size_t m_sealedCount = 0;
+
+    std::atomic<std::uint32_t> m_count = 0;
+    std::atomic<IndexTable const *> m_index = nullptr;
+    std::vector<std::unique_ptr<IndexTable>> m_indexTables;
+
     static bool Destroyed;
     friend CustomTypes *customTypes();
 };
@@ -47,6 +151,10 @@ CustomTypes::CustomTypes() {}
 CustomTypes::~CustomTypes()
 {
     std::unique_lock lock{m_lock};
+    m_sealed.store(nullptr, std::memory_order_release);
+    m_tables.clear();
+    m_index.store(nullptr, std::memory_order_release);
+    m_indexTables.clear();
     m_items.clear();
     m_names.clear();
     Destroyed = true;
@@ -62,11 +170,33 @@ inline TypeInfo const* CustomTypes::getTypeInfo(MetaType_ID typeId) const
     return reinterpret_cast<TypeInfo const *>(typeId.value());
 }
 
+inline TypeInfo const* CustomTypes::getTypeInfo(std::uint32_t index) const
+{
+    if (auto *table = m_index.load(std::memory_order_acquire); table && index < table->capacity)
+        return table->items[index];
+    return nullptr;
+}
+
+inline std::uint32_t CustomTypes::count() const
+{
+    return m_count.load(std::memory_order_acquire);
+}
+
 TypeInfo const* CustomTypes::getTypeInfo(std::string_view name) const
 {
     if (name.empty())
         return nullptr;
 
+    // Sealed: plain acquire load of the snapshot, no read-modify-write
+    if (auto *table = m_sealed.load(std::memory_order_acquire))
+    {
+        if (auto *result = table->find(name))
+            return result;
+        if (m_lateCount.load(std::memory_order_acquire) == 0 &&
+            m_sealed.load(std::memory_order_acquire) == table)
+            return nullptr;
+    }
+
     std::shared_lock lock{m_lock};
     if (auto it = m_names.find(name); it != std::end(m_names))
         return it->second;
@@ -74,7 +204,7 @@ TypeInfo const* CustomTypes::getTypeInfo(std::string_view name) const
     return nullptr;
 }
 
-TypeInfo const* CustomTypes::addTypeInfo(std::string_view name, std::size_t size, MetaType_ID decay,
+TypeInfo const* CustomTypes::addTypeInfo(std::string_view name, std::size_t size, std::size_t align, MetaType_ID decay,
                                          uint16_t arity, uint16_t const_mask, TypeFlags flags,
                                          metatype_manager_t const *manager)
 {
@@ -84,14 +214,61 @@ TypeInfo const* CustomTypes::addTypeInfo(std::string_view name, std::size_t size
     std::unique_lock lock{m_lock};
     if (auto it = m_names.find(name); it == std::end(m_names))
     {
-        auto &result = m_items.emplace_front(name, size, decay, arity, const_mask, flags, manager);
+        auto index = m_count.load(std::memory_order_relaxed) + 1;
+        auto *table = m_index.load(std::memory_order_relaxed);
+        if (!table || index >= table->capacity)
+        {
+            auto capacity = table ? table->capacity * 2 : std::uint32_t{256};
+            auto &grown = m_indexTables.emplace_back(new IndexTable{capacity});
+            if (table)
+                std::copy(table->items.get(), table->items.get() + table->capacity, grown->items.get());
+            table = grown.get();
+        }
+
+        auto &result = m_items.emplace_front(name, size, align, decay, arity, const_mask, flags, manager, index);
+        table->items[index] = &result;
+        m_index.store(table, std::memory_order_release);
+        m_count.store(index, std::memory_order_release);
         m_names.emplace(name, &result);
+        // Late registration goes to overflow until it's large enough to rebuild snapshot
+        if (m_sealed.load(std::memory_order_relaxed))
+        {
+            auto late = m_lateCount.load(std::memory_order_relaxed) + 1;
+            if (late >= m_sealedCount)
+                publish();
+            else
+                m_lateCount.store(late, std::memory_order_release);
+        }
         return &result;
     }
     else
         return it->second;
 }
 
+void CustomTypes::seal()
+{
+    std::unique_lock lock{m_lock};
+    if (!m_sealed.load(std::memory_order_relaxed))
+        publish();
+}
+
+bool CustomTypes::sealed() const noexcept
+{
+    return (m_sealed.load(std::memory_order_acquire) != nullptr);
+}
+
+void CustomTypes::publish()
+{
+    auto table = std::make_unique<NameTable>(m_names.size());
+    for (auto const &item: m_names)
+        table->insert(item.second);
+
+    m_sealed.store(table.get(), std::memory_order_release);
+    m_tables.push_back(std::move(table));
+    m_sealedCount = m_names.size();
+    m_lateCount.store(0, std::memory_order_release);
+}
+
 inline CustomTypes* customTypes()
 {
     if (CustomTypes::Destroyed)
@@ -120,6 +297,21 @@ MetaType::MetaType(std::string_view name) noexcept
 
 }
 
+MetaType MetaType::fromIndex(std::uint32_t index) noexcept
+{
+    auto result = MetaType{};
+    if (auto *types = customTypes())
+        result.m_typeInfo = types->getTypeInfo(index);
+    return result;
+}
+
+std::uint32_t MetaType::typeCount() noexcept
+{
+    if (auto *types = customTypes())
+        return types->count();
+    return 0;
+}
+
 MetaType_ID MetaType::typeId() const noexcept
 {
     if (auto *types = customTypes())
@@ -128,6 +320,12 @@ MetaType_ID MetaType::typeId() const noexcept
     return MetaType_ID{};
 }
 
+std::uint32_t MetaType::index() const noexcept
+{
+    return m_typeInfo ? m_typeInfo->index
+                      : 0;
+}
+
 MetaType_ID MetaType::decayId() const noexcept
 {
     return m_typeInfo ? m_typeInfo->decay
@@ -147,6 +345,12 @@ std::size_t MetaType::typeSize() const noexcept
                       : 0;
 }
 
+std::size_t MetaType::typeAlign() const noexcept
+{
+    return m_typeInfo ? m_typeInfo->align
+                      : 0;
+}
+
 TypeFlags MetaType::typeFlags() const noexcept
 {
     return m_typeInfo ? m_typeInfo->flags
@@ -159,67 +363,79 @@ std::uint16_t MetaType::pointerArity() const noexcept
                       : 0;
 }
 
+namespace {
+
+    inline bool hasFlag(TypeFlags flags, TypeFlags flag) noexcept
+    {
+        return ((flags & flag) == flag);
+    }
+
+} //namespace
+
 bool MetaType::compatible(MetaType fromType, MetaType toType) noexcept
 {
     if (!fromType.valid() || !toType.valid())
         return false;
 
-    if (!fromType.isLvalueReference() && toType.isLvalueReference() && !toType.isConst())
+    auto const &fromInfo = *fromType.m_typeInfo;
+    auto const &toInfo = *toType.m_typeInfo;
+
+    auto fromLvalue = hasFlag(fromInfo.flags, TypeFlags::LvalueReference);
+    auto toLvalue = hasFlag(toInfo.flags, TypeFlags::LvalueReference);
+    auto toReference = toLvalue || hasFlag(toInfo.flags, TypeFlags::RvalueReference);
+
+    if (!fromLvalue && toLvalue && !hasFlag(toInfo.flags, TypeFlags::Const))
         return false;
-    if (fromType.isLvalueReference() && toType.isRvalueReference())
+    if (fromLvalue && !toLvalue && toReference)
         return false;
 
+    auto fromArray = hasFlag(fromInfo.flags, TypeFlags::Array) && !hasFlag(fromInfo.flags, TypeFlags::Pointer);
+    auto toArray = hasFlag(toInfo.flags, TypeFlags::Array) && !hasFlag(toInfo.flags, TypeFlags::Pointer);
+
     // check array length
-    if (fromType.isArray() && toType.isArray() && (fromType.typeSize() < toType.typeSize()))
+    if (fromArray && toArray && (fromInfo.size < toInfo.size))
         return false;
 
     // decay array to pointer
-    auto arity1 = fromType.m_typeInfo->arity;
-    if (fromType.isArray() && toType.isPointer())
+    auto arity1 = unsigned{fromInfo.arity};
+    if (fromArray && hasFlag(toInfo.flags, TypeFlags::Pointer))
         ++arity1;
 
     // compare pointer arity
-    if (arity1 != toType.m_typeInfo->arity)
+    if (arity1 != toInfo.arity)
         return false;
 
     // skip top-most const when destination type isn't reference
-    if (!toType.isReference())
+    if (!toReference)
     {
         if (!arity1)
             return true;
         --arity1;
     }
 
-    auto from = TypeInfo::const_bitset_t{fromType.m_typeInfo->const_mask};
-    auto to   = TypeInfo::const_bitset_t{toType.m_typeInfo->const_mask};
+    auto from = unsigned{fromInfo.const_mask};
+    auto to   = unsigned{toInfo.const_mask};
 
     // Decay to reference to pointer should be reference to const pointer
-    if (fromType.isArray() && !toType.isArray() && toType.isReference())
-        from.set(arity1);
-
-    if (from == to)
+    if (fromArray && !toArray && toReference)
+        from |= 1u << arity1;
+
+    // Const may be added at first level that differs,
+    // but only if every outer level is const too
+    auto levels = (2u << arity1) - 1;
+    auto diff = (from ^ to) & levels;
+    if (!diff)
         return true;
 
-    for (decltype(arity1) i = 0; i <= arity1; ++i)
-    {
-        auto f = from.test(i);
-        auto t = to.test(i);
-
-        if (f && !t)
-            return false;
+    auto first = diff & (~diff + 1);
+    if (from & first)
+        return false;
 
-        if (!f & t)
-        {
-            for (decltype(arity1) j = i + 1; j <= arity1; ++j)
-                if (!to.test(j))
-                    return false;
-            break;
-        }
-    }
-    return true;
+    auto outer = levels & ~((first << 1) - 1);
+    return ((to & outer) == outer);
 }
 
-MetaType_ID MetaType::registerMetaType(std::string_view name, std::size_t size, MetaType_ID decay,
+MetaType_ID MetaType::registerMetaType(std::string_view name, std::size_t size, std::size_t align, MetaType_ID decay,
                                        std::uint16_t arity, std::uint16_t const_mask,
                                        TypeFlags flags, metatype_manager_t const *manager)
 {
@@ -227,10 +443,23 @@ MetaType_ID MetaType::registerMetaType(std::string_view name, std::size_t size,
     if (!types)
         return MetaType_ID{};
 
-    auto result = types->addTypeInfo(name, size, decay, arity, const_mask, flags, manager);
+    auto result = types->addTypeInfo(name, size, align, decay, arity, const_mask, flags, manager);
     return types->getTypeId(result);
 }
 
+void MetaType::sealRegistry()
+{
+    if (auto *types = customTypes())
+        types->seal();
+}
+
+bool MetaType::registrySealed() noexcept
+{
+    if (auto *types = customTypes())
+        return types->sealed();
+    return false;
+}
+
 MetaClass const* MetaType::metaClass() const noexcept
 {
     return m_typeInfo ? m_typeInfo->metaClass.load()
@@ -243,13 +472,22 @@ MetaClass const* MetaType::metaClass() const noexcept
 
 void* MetaType::allocate() const
 {
-    return m_typeInfo ? m_typeInfo->manager->f_allocate()
-                      : nullptr;
+    if (!m_typeInfo)
+        return nullptr;
+
+    if (auto *resource = memoryResource())
+        return resource->allocate(m_typeInfo->size, m_typeInfo->align);
+    return m_typeInfo->manager->f_allocate();
 }
 
 void MetaType::deallocate(void *ptr) const
 {
-    if (m_typeInfo)
+    if (!m_typeInfo || !ptr)
+        return;
+
+    if (auto *resource = memoryResource())
+        resource->deallocate(ptr, m_typeInfo->size, m_typeInfo->align);
+    else
         m_typeInfo->manager->f_deallocate(ptr);
 }
 
@@ -283,21 +521,81 @@ void MetaType::destroy(void *ptr) const noexcept
         m_typeInfo->manager->f_destroy(ptr);
 }
 
+void MetaType::construct_n(void *where, std::size_t count) const
+{
+    if (m_typeInfo)
+        m_typeInfo->manager->f_default_construct_n(where, count);
+}
+
+void MetaType::copy_n(void const *source, void *where, std::size_t count) const
+{
+    if (m_typeInfo)
+        m_typeInfo->manager->f_copy_construct_n(source, where, count);
+}
+
+void MetaType::move_n(void *source, void *where, std::size_t count) const
+{
+    if (m_typeInfo)
+        m_typeInfo->manager->f_move_construct_n(source, where, count);
+}
+
+void MetaType::destroy_n(void *ptr, std::size_t count) const noexcept
+{
+    if (m_typeInfo)
+        m_typeInfo->manager->f_destroy_n(ptr, count);
+}
+
 bool MetaType::compare_eq(void const *lhs, void const *rhs) const
 {
     return m_typeInfo ? m_typeInfo->manager->f_compare_eq(lhs, rhs)
                       : false;
 }
 
+std::size_t MetaType::hash(void const *value) const
+{
+    if (m_typeInfo && m_typeInfo->manager && m_typeInfo->manager->f_hash)
+        return m_typeInfo->manager->f_hash(value);
+    return 0;
+}
+
+bool MetaType::less(void const *lhs, void const *rhs) const
+{
+    using namespace std::literals;
+
+    if (m_typeInfo && m_typeInfo->manager && m_typeInfo->manager->f_compare_less)
+        return m_typeInfo->manager->f_compare_less(lhs, rhs);
+    throw runtime_error{"Type T = "s + typeName() + " isn't LT_Comparable"};
+}
+
+int MetaType::compare(void const *lhs, void const *rhs) const
+{
+    if (less(lhs, rhs))
+        return -1;
+    if (less(rhs, lhs))
+        return 1;
+    return 0;
+}
+
 void* MetaType::construct(void *copy, bool movable) const
 {
     auto result = allocate();
-    if (!copy)
-        default_construct(result);
-    else if (!movable)
-        copy_construct(copy, result);
-    else
-        move_or_copy(copy, result);
+    if (!result)
+        return nullptr;
+
+    try
+    {
+        if (!copy)
+            default_construct(result);
+        else if (!movable)
+            copy_construct(copy, result);
+        else
+            move_or_copy(copy, result);
+    }
+    catch (...)
+    {
+        deallocate(result);
+        throw;
+    }
 
     return result;
 }
@@ -311,96 +609,410 @@ void MetaType::destruct(void *instance) const
     }
 }
 
+void* MetaType::construct(void *copy, bool movable, MemoryResource *resource) const
+{
+    if (!resource)
+        return construct(copy, movable);
+    if (!m_typeInfo)
+        return nullptr;
+
+    auto result = resource->allocate(m_typeInfo->size, m_typeInfo->align);
+    try
+    {
+        if (!copy)
+            default_construct(result);
+        else if (!movable)
+            copy_construct(copy, result);
+        else
+            move_or_copy(copy, result);
+    }
+    catch (...)
+    {
+        resource->deallocate(result, m_typeInfo->size, m_typeInfo->align);
+        throw;
+    }
+
+    return result;
+}
+
+void MetaType::destruct(void *instance, MemoryResource *resource) const
+{
+    if (!resource)
+        return destruct(instance);
+
+    if (instance && m_typeInfo)
+    {
+        destroy(instance);
+        resource->deallocate(instance, m_typeInfo->size, m_typeInfo->align);
+    }
+}
+
+void MetaType::setMemoryResource(MemoryResource *resource) const noexcept
+{
+    if (m_typeInfo)
+        decayInfo(m_typeInfo)->resource.store(resource, std::memory_order_release);
+}
+
+MemoryResource* MetaType::memoryResource() const noexcept
+{
+    return m_typeInfo ? decayInfo(m_typeInfo)->resource.load(std::memory_order_acquire)
+                      : nullptr;
+}
+
 //--------------------------------------------------------------------------------------------------------------------------------
 // Converter
 //--------------------------------------------------------------------------------------------------------------------------------
 
 namespace {
 
-    template<typename F>
-    class MetaTypeFunctionList
+    // Owns converter row of every source type. Rows are read without locking
+    // through TypeInfo::converters and live as long as registry.
+    class RTTI_PRIVATE ConverterRegistry
     {
     public:
-        using key_t = std::pair<MetaType_ID, MetaType_ID>;
-
-        ~MetaTypeFunctionList()
+        ~ConverterRegistry()
         {
-            std::unique_lock lock{m_lock};
-            m_items.clear();
+            std::lock_guard lock{m_lock};
+            for (auto *item: m_sources)
+                item->converters.store(nullptr, std::memory_order_release);
+            m_rows.clear();
             Destroyed = true;
         }
 
-        bool find(key_t const &key) const
+        internal::ConvertFunctionBase const* get(TypeInfo const *from, TypeInfo const *to) const noexcept
         {
-            std::shared_lock lock{m_lock};
-            return (m_items.find(key) != std::end(m_items));
+            if (auto *row = from->converters.load(std::memory_order_acquire))
+                return row->find(to);
+            return nullptr;
         }
 
-        bool add(key_t key, F const *func)
+        // Chain of converters through intermediate types, resolved on first use
+        internal::ConverterPath const* path(TypeInfo const *from, TypeInfo const *to)
+        {
+            if (!m_chaining.load(std::memory_order_relaxed))
+                return nullptr;
+
+            auto *row = from->converters.load(std::memory_order_acquire);
+            if (!row)
+                return nullptr;
+
+            if (auto *result = row->findPath(to, m_version.load(std::memory_order_acquire)))
+                return result;
+
+            return resolve(row, from, to);
+        }
+
+        bool add(TypeInfo const *from, TypeInfo const *to, internal::ConvertFunctionBase const *func)
         {
             if (!func)
                 return false;
 
-            std::unique_lock lock{m_lock};
-            if (auto search = m_items.find(key); search != std::end(m_items))
-                return false;
+            std::lock_guard lock{m_lock};
+            auto *row = from->converters.load(std::memory_order_relaxed);
+            if (!row)
+            {
+                row = m_rows.emplace_back(new internal::ConverterRow{}).get();
+                m_sources.push_back(from);
+                from->converters.store(row, std::memory_order_release);
+            }
 
-            m_items.emplace(key, func);
+            if (!row->add(to, func))
+                return false;
+            m_version.fetch_add(1, std::memory_order_acq_rel);
             return true;
         }
 
-        F const* get(key_t const &key) const
+        void remove(TypeInfo const *from, TypeInfo const *to)
         {
-            std::shared_lock lock{m_lock};
-            if (auto search = m_items.find(key); search != std::end(m_items))
-                return search->second;
-            return nullptr;
+            std::lock_guard lock{m_lock};
+            auto *row = from->converters.load(std::memory_order_relaxed);
+            if (row && row->remove(to))
+                m_version.fetch_add(1, std::memory_order_acq_rel);
         }
 
-        void remove(key_t const &key)
+        bool chaining() const noexcept
         {
-            std::unique_lock lock{m_lock};
-            m_items.erase(key);
+            return m_chaining.load(std::memory_order_relaxed);
         }
+
+        void setChaining(bool enable)
+        {
+            std::lock_guard lock{m_lock};
+            m_chaining.store(enable, std::memory_order_relaxed);
+        }
+
     private:
-        struct hash_key
+        internal::ConverterPath const* resolve(internal::ConverterRow *row, TypeInfo const *from, TypeInfo const *to)
         {
-            using result_type = std::size_t;
-            using argument_type = key_t;
-            result_type operator()(argument_type const &key) const
+            std::lock_guard lock{m_lock};
+            auto version = m_version.load(std::memory_order_relaxed);
+            if (auto *result = row->findPath(to, version))
+                return result;
+
+            return row->addPath({to, search(from, to)}, version);
+        }
+
+        // Breadth first, so the chain with the fewest conversions wins
+        std::vector<internal::ConverterEntry> search(TypeInfo const *from, TypeInfo const *to) const
+        {
+            struct Node
             {
-                return std::_Hash_impl::__hash_combine(key.first.value(),
-                            std::_Hash_impl::hash(key.second.value()));
+                TypeInfo const *type;
+                std::size_t parent;
+                internal::ConvertFunctionBase const *func;
+            };
+
+            std::vector<Node> nodes{{from, 0, nullptr}};
+            auto found = false;
+            for (std::size_t i = 0; i < nodes.size() && !found; ++i)
+            {
+                auto *row = nodes[i].type->converters.load(std::memory_order_relaxed);
+                if (!row)
+                    continue;
+
+                row->for_each([&nodes, &found, i, to](TypeInfo const *type, auto const *func)
+                {
+                    if (found)
+                        return;
+                    auto visited = std::any_of(std::begin(nodes), std::end(nodes),
+                                               [type](auto const &node) { return node.type == type; });
+                    if (visited)
+                        return;
+
+                    nodes.push_back({type, i, func});
+                    found = (type == to);
+                });
             }
-        };
+            if (!found)
+                return {};
+
+            std::vector<internal::ConverterEntry> result;
+            for (auto j = nodes.size() - 1; j != 0; j = nodes[j].parent)
+                result.push_back({nodes[j].type, nodes[j].func});
+            std::reverse(std::begin(result), std::end(result));
+            return result;
+        }
 
-        mutable std::shared_mutex m_lock;
-        std::unordered_map<key_t, F const*, hash_key> m_items;
+        std::mutex m_lock;
+        std::atomic<std::uint32_t> m_version = 0;
+        std::atomic<bool> m_chaining = false;
+        std::vector<TypeInfo const*> m_sources;
+        std::vector<std::unique_ptr<internal::ConverterRow>> m_rows;
 
         static bool Destroyed;
 
-        friend MetaTypeFunctionList<internal::ConvertFunctionBase>* customConverters();
+        friend ConverterRegistry* customConverters();
     };
 
-    template<typename F>
-    bool MetaTypeFunctionList<F>::Destroyed = false;
+    bool ConverterRegistry::Destroyed = false;
 
-    inline MetaTypeFunctionList<internal::ConvertFunctionBase>* customConverters()
+    inline ConverterRegistry* customConverters()
     {
-        if (MetaTypeFunctionList<internal::ConvertFunctionBase>::Destroyed)
+        if (ConverterRegistry::Destroyed)
             return nullptr;
 
-        static MetaTypeFunctionList<internal::ConvertFunctionBase> result;
+        static ConverterRegistry result;
         return &result;
     }
 
+    // Intermediate value of a converter chain. Small values are kept on stack,
+    // the buffer is reused by every hop that writes into it.
+    class RTTI_PRIVATE ConvertScratch
+    {
+    public:
+        ConvertScratch() = default;
+        ConvertScratch(ConvertScratch const&) = delete;
+        ConvertScratch& operator=(ConvertScratch const&) = delete;
+
+        ~ConvertScratch()
+        {
+            clear();
+            if (m_heap)
+                m_heapType->manager->f_deallocate(m_heap);
+        }
+
+        void* prepare(TypeInfo const *type)
+        {
+            clear();
+            if (fitsLocal(type))
+                return m_local;
+
+            if (!m_heap || m_heapType->size < type->size || m_heapType->align < type->align)
+            {
+                if (m_heap)
+                    m_heapType->manager->f_deallocate(m_heap);
+                m_heap = nullptr;
+                m_heap = type->manager->f_allocate();
+                m_heapType = type;
+            }
+            return m_heap;
+        }
+
+        void* commit(TypeInfo const *type) noexcept
+        {
+            m_type = type;
+            return data();
+        }
+
+        void clear() noexcept
+        {
+            if (m_type)
+                m_type->manager->f_destroy(data());
+            m_type = nullptr;
+        }
+
+    private:
+        bool fitsLocal(TypeInfo const *type) const noexcept
+        {
+            return (type->size <= sizeof(m_local) && type->align <= alignof(std::max_align_t));
+        }
+
+        void* data() noexcept
+        {
+            return fitsLocal(m_type) ? static_cast<void*>(m_local) : m_heap;
+        }
+
+        alignas(std::max_align_t) char m_local[64];
+        TypeInfo const *m_type = nullptr;
+        TypeInfo const *m_heapType = nullptr;
+        void *m_heap = nullptr;
+    };
+
+    bool invoke(internal::ConverterPath const &path, void const *from, void *to)
+    {
+        ConvertScratch scratch[2];
+
+        auto last = path.steps.size() - 1;
+        for (std::size_t i = 0; i <= last; ++i)
+        {
+            auto const &step = path.steps[i];
+            auto &output = scratch[i % 2];
+            auto *buffer = (i == last) ? to : output.prepare(step.to);
+            if (!step.func->invoke(from, buffer))
+                return false;
+
+            if (i != last)
+                from = output.commit(step.to);
+            if (i != 0)
+                scratch[(i - 1) % 2].clear();
+        }
+        return true;
+    }
+
+    // Built-in bulk conversion between arithmetic types, loops are left to the
+    // compiler to vectorize. Order matters: bool, integral types, floating point.
+    using ArithmeticTypes = std::tuple<bool,
+                                       char, signed char, unsigned char,
+                                       wchar_t, char16_t, char32_t,
+                                       short, unsigned short, int, unsigned int,
+                                       long, unsigned long, long long, unsigned long long,
+                                       float, double, long double>;
+    constexpr auto ArithmeticCount = std::tuple_size_v<ArithmeticTypes>;
+    constexpr auto FirstIntegral = std::size_t{1};
+    constexpr auto LastIntegral = std::size_t{14};
+
+    using convert_n_t = void (*) (void const*, void*, std::size_t);
+
+    template<typename From, typename To>
+    void convert_n_kernel(void const *from, void *to, std::size_t count)
+    {
+        auto in = static_cast<From const*>(from);
+        auto out = static_cast<To*>(to);
+        for (std::size_t i = 0; i < count; ++i)
+            out[i] = static_cast<To>(in[i]);
+    }
+
+    template<typename From, std::size_t ...I>
+    constexpr std::array<convert_n_t, ArithmeticCount> kernelRow(std::index_sequence<I...>)
+    {
+        return {&convert_n_kernel<From, std::tuple_element_t<I, ArithmeticTypes>>...};
+    }
+
+    template<std::size_t ...I>
+    constexpr auto kernelTable(std::index_sequence<I...> seq)
+    {
+        return std::array<std::array<convert_n_t, ArithmeticCount>, ArithmeticCount>{
+            kernelRow<std::tuple_element_t<I, ArithmeticTypes>>(seq)...};
+    }
+
+    constexpr auto ArithmeticKernels = kernelTable(std::make_index_sequence<ArithmeticCount>{});
+
+    template<std::size_t ...I>
+    std::array<MetaType_ID, ArithmeticCount> arithmeticIds(std::index_sequence<I...>)
+    {
+        return {metaTypeId<std::tuple_element_t<I, ArithmeticTypes>>()...};
+    }
+
+    // Position in ArithmeticTypes, ArithmeticCount if type isn't arithmetic
+    std::size_t arithmeticIndex(MetaType_ID decay)
+    {
+        static auto const ids = arithmeticIds(std::make_index_sequence<ArithmeticCount>{});
+        auto it = std::find(std::begin(ids), std::end(ids), decay);
+        return static_cast<std::size_t>(std::distance(std::begin(ids), it));
+    }
+
+    inline bool isPlainEnum(TypeInfo const *info)
+    {
+        auto mask = TypeFlags::Enum | TypeFlags::Pointer | TypeFlags::Array;
+        return ((info->flags & mask) == TypeFlags::Enum);
+    }
+
+    // Applies converter (or chain) element by element, results already
+    // constructed are destroyed on failure
+    template<typename F>
+    bool convert_n_each(F &&func, void const *from, TypeInfo const *fromInfo,
+                        void *to, TypeInfo const *toInfo, std::size_t count)
+    {
+        auto in = static_cast<char const*>(from);
+        auto out = static_cast<char*>(to);
+        std::size_t i = 0;
+        auto rollback = [&]
+        {
+            for (std::size_t j = 0; j < i; ++j)
+                toInfo->manager->f_destroy(out + j * toInfo->size);
+        };
+
+        try
+        {
+            for (; i < count; ++i)
+                if (!func(in + i * fromInfo->size, out + i * toInfo->size))
+                    break;
+        }
+        catch (...)
+        {
+            rollback();
+            throw;
+        }
+
+        if (i == count)
+            return true;
+
+        rollback();
+        return false;
+    }
+
 } //namespace
 
 bool MetaType::hasConverter(MetaType fromType, MetaType toType) noexcept
 {
     if (fromType.valid() && toType.valid())
         if (auto list = customConverters())
-            return list->find({fromType.m_typeInfo->decay, toType.m_typeInfo->decay});
+        {
+            auto from = decayInfo(fromType);
+            auto to = decayInfo(toType);
+            if (list->get(from, to))
+                return true;
+
+            try
+            {
+                auto path = list->path(from, to);
+                return (path && !path->steps.empty());
+            }
+            catch (...)
+            {
+                return false;
+            }
+        }
     return false;
 }
 
@@ -420,7 +1032,7 @@ bool MetaType::registerConverter(MetaType_ID fromTypeId, MetaType_ID toTypeId,
 
     if (fromType.valid() && toType.valid())
         if (auto list = customConverters())
-            return list->add({fromType.m_typeInfo->decay, toType.m_typeInfo->decay}, &converter);
+            return list->add(decayInfo(fromType), decayInfo(toType), &converter);
     return false;
 }
 
@@ -429,9 +1041,14 @@ bool MetaType::convert(void const *from, MetaType fromType, void *to, MetaType t
     if (fromType.valid() && toType.valid())
         if (auto list = customConverters())
         {
-            auto converter = list->get({fromType.m_typeInfo->decay, toType.m_typeInfo->decay});
-            if (converter)
+            auto fromInfo = decayInfo(fromType);
+            auto toInfo = decayInfo(toType);
+            if (auto converter = list->get(fromInfo, toInfo))
                 return converter->invoke(from, to);
+
+            auto path = list->path(fromInfo, toInfo);
+            if (path && !path->steps.empty())
+                return invoke(*path, from, to);
         }
     return false;
 }
@@ -444,6 +1061,60 @@ bool MetaType::convert(void const *from, MetaType_ID fromTypeId, void *to, MetaT
     return convert(from, fromType, to, toType);
 }
 
+bool MetaType::convert_n(void const *from, MetaType fromType, void *to, MetaType toType,
+                         std::size_t count)
+{
+    if (!fromType.valid() || !toType.valid())
+        return false;
+
+    auto fromInfo = decayInfo(fromType);
+    auto toInfo = decayInfo(toType);
+
+    auto fromIndex = arithmeticIndex(fromInfo->decay);
+    auto toIndex = arithmeticIndex(toInfo->decay);
+    if (fromIndex < ArithmeticCount && toIndex < ArithmeticCount)
+    {
+        ArithmeticKernels[fromIndex][toIndex](from, to, count);
+        return true;
+    }
+
+    // Enum to integral type of the same size is plain copy
+    if (isPlainEnum(fromInfo) && toIndex >= FirstIntegral && toIndex <= LastIntegral &&
+        fromInfo->size == toInfo->size)
+    {
+        if (count)
+            std::memcpy(to, from, count * toInfo->size);
+        return true;
+    }
+
+    if (fromInfo == toInfo)
+    {
+        toInfo->manager->f_copy_construct_n(from, to, count);
+        return true;
+    }
+
+    auto list = customConverters();
+    if (!list)
+        return false;
+
+    if (auto converter = list->get(fromInfo, toInfo))
+    {
+        auto func = [converter](void const *in, void *out)
+        { return converter->invoke(in, out); };
+        return convert_n_each(func, from, fromInfo, to, toInfo, count);
+    }
+
+    auto path = list->path(fromInfo, toInfo);
+    if (path && !path->steps.empty())
+    {
+        auto func = [path](void const *in, void *out)
+        { return invoke(*path, in, out); };
+        return convert_n_each(func, from, fromInfo, to, toInfo, count);
+    }
+
+    return false;
+}
+
 void MetaType::unregisterConverter(MetaType_ID fromTypeId, MetaType_ID toTypeId)
 {
     auto fromType = MetaType{fromTypeId};
@@ -451,7 +1122,20 @@ void MetaType::unregisterConverter(MetaType_ID fromTypeId, MetaType_ID toTypeId)
 
     if (fromType.valid() && toType.valid())
         if (auto list = customConverters())
-            list->remove({fromType.m_typeInfo->decay, toType.m_typeInfo->decay});
+            list->remove(decayInfo(fromType), decayInfo(toType));
+}
+
+void MetaType::setConverterChaining(bool enable)
+{
+    if (auto list = customConverters())
+        list->setChaining(enable);
+}
+
+bool MetaType::converterChaining() noexcept
+{
+    if (auto list = customConverters())
+        return list->chaining();
+    return false;
 }
 
 static char const *flag_names[] = {"None",
@@ -481,7 +1165,9 @@ static char const *flag_names[] = {"None",
                                    "MoveAssignable",
                                    "Destructible",
 
-                                   "EQ_Comparable"};
+                                   "EQ_Comparable",
+                                   "Hashable",
+                                   "LT_Comparable"};
 
 inline static std::string_view flag_name(TypeFlags value)
 {
@@ -552,6 +1238,10 @@ std::ostream& operator<<(std::ostream &stream, TypeFlags value)
 
     if (check_flag(value, TypeFlags::EQ_Comparable))
         it = flag_name(TypeFlags::EQ_Comparable);
+    if (check_flag(value, TypeFlags::Hashable))
+        it = flag_name(TypeFlags::Hashable);
+    if (check_flag(value, TypeFlags::LT_Comparable))
+        it = flag_name(TypeFlags::LT_Comparable);
 
     return stream;
 }
@@ -2,9 +2,11 @@
 #define METACLASS_P_H
 
 #include "metacontainer_p.h"
+#include "reclaim_p.h"
 
 #include <rtti/metaclass.h>
 #include <algorithm>
+#include <limits>
 
 namespace rtti {
 namespace internal {
@@ -41,6 +43,14 @@ namespace internal {
             return (search != std::end(m_items));
         }
 
+        template<typename F>
+        void for_each(F &&func) const
+        {
+            std::shared_lock lock{m_lock};
+            for (auto item: m_items)
+                func(item);
+        }
+
     private:
         mutable std::shared_mutex m_lock;
         std::vector<MetaType_ID> m_items;
@@ -49,14 +59,19 @@ namespace internal {
     class RTTI_PRIVATE BaseClassList
     {
     public:
-        using item_t      = std::pair<MetaType_ID, MetaClass::cast_func_t>;
+        struct item_t
+        {
+            MetaType_ID typeId;
+            MetaClass::cast_func_t caster;
+            bool isVirtual;
+        };
         using container_t = std::vector<item_t>;
 
-        void add(MetaType_ID value, MetaClass::cast_func_t func)
+        void add(MetaType_ID value, MetaClass::cast_func_t func, bool isVirtual)
         {
             std::unique_lock lock{m_lock};
             if (!find_imp(value))
-                m_items.emplace_back(value, func);
+                m_items.push_back({value, func, isVirtual});
         }
 
         std::size_t count() const
@@ -69,7 +84,7 @@ namespace internal {
         {
             std::shared_lock lock{m_lock};
             if (index < m_items.size())
-                return m_items[index].first;
+                return m_items[index].typeId;
             return MetaType_ID{};
         }
 
@@ -86,7 +101,7 @@ namespace internal {
         bool find_imp(MetaType_ID value) const
         {
             auto search = std::find_if(std::begin(m_items), std::end(m_items),
-                                       [value](auto const &item) { return (value == item.first); });
+                                       [value](auto const &item) { return (value == item.typeId); });
             return (search != std::end(m_items));
         }
 
@@ -104,6 +119,76 @@ namespace internal {
                 break;
         }
     }
+
+    // Own and inherited members of class, base members are shadowed by
+    // members of derived class and by members of preceding bases
+    struct RTTI_PRIVATE MemberTable
+    {
+        template<typename T>
+        static T const* probe(std::unordered_map<std::string_view, T const*> const &items,
+                              std::string_view name)
+        {
+            auto search = items.find(name);
+            return (search != std::end(items) ? search->second : nullptr);
+        }
+
+        template<typename T>
+        static T const* probe(std::unordered_map<std::size_t, T const*> const &items, symbol name)
+        {
+            auto search = items.find(name.id());
+            return (search != std::end(items) ? search->second : nullptr);
+        }
+
+        MetaMethod const* method(std::string_view name) const
+        { return probe(methods, name); }
+        MetaMethod const* method(symbol name) const
+        { return probe(methodSymbols, name); }
+        MetaProperty const* property(std::string_view name) const
+        { return probe(properties, name); }
+        MetaProperty const* property(symbol name) const
+        { return probe(propertySymbols, name); }
+
+        std::size_t generation = 0;
+        std::unordered_map<std::string_view, MetaMethod const*> methods;
+        std::unordered_map<std::string_view, MetaProperty const*> properties;
+        // Same items by symbol id
+        std::unordered_map<std::size_t, MetaMethod const*> methodSymbols;
+        std::unordered_map<std::size_t, MetaProperty const*> propertySymbols;
+    };
+
+    struct RTTI_PRIVATE CastPath
+    {
+        static constexpr auto UnknownOffset = std::numeric_limits<std::ptrdiff_t>::min();
+
+        std::vector<MetaClass::cast_func_t> casters;
+        bool hasVirtualBase = false;
+        // Path through non-virtual bases only is constant offset, it's recorded by first cast
+        mutable std::atomic<std::ptrdiff_t> offset = UnknownOffset;
+    };
+
+    // Ancestors of class (including class itself) over dense class indexes,
+    // with path from class to each of them
+    struct RTTI_PRIVATE AncestorTable
+    {
+
+        bool contains(std::size_t index) const noexcept
+        {
+            auto word = index / 64;
+            return (word < bits.size() && (bits[word] & (std::uint64_t{1} << (index % 64))));
+        }
+
+        void insert(std::size_t index)
+        {
+            auto word = index / 64;
+            if (word >= bits.size())
+                bits.resize(word + 1);
+            bits[word] |= std::uint64_t{1} << (index % 64);
+        }
+
+        std::size_t generation = 0;
+        std::vector<std::uint64_t> bits;
+        std::unordered_map<std::size_t, CastPath> paths;
+    };
 } // namespace internal
 
 class RTTI_PRIVATE MetaClassPrivate: public MetaContainerPrivate
@@ -114,11 +199,38 @@ public:
         , m_typeId{typeId}
     {}
 
+    // Changed whenever member or base class is added to class or to any of its bases
+    std::size_t definitionGeneration() const noexcept
+    { return m_definitionGeneration.load(std::memory_order_acquire); }
+
 private:
+    void definitionChanged() const override;
+    internal::MemberTable const* memberTable(MetaClass const &self, internal::ReadGuard const &guard) const;
+    bool collectMembers(MetaClass const &self, internal::MemberTable &table) const;
+    template<typename Name>
+    MetaMethod const* lookupMethod(MetaClass const &self, Name name) const;
+    template<typename Name>
+    MetaProperty const* lookupProperty(MetaClass const &self, Name name) const;
+    internal::AncestorTable const* ancestorTable(MetaClass const &self, internal::ReadGuard const &guard) const;
+
+    // Changed whenever base class is added to class or to any of its bases
+    std::size_t hierarchyGeneration() const noexcept
+    { return m_hierarchyGeneration.load(std::memory_order_acquire); }
+    void hierarchyChanged() const;
+
     MetaType_ID m_typeId;
+    std::size_t const m_index = m_classCount.fetch_add(1, std::memory_order_relaxed);
     internal::BaseClassList m_baseClasses;
     internal::DerivedClassList m_derivedClasses;
 
+    mutable std::atomic_size_t m_definitionGeneration = 0;
+    internal::SharedTable<internal::MemberTable> m_memberTable;
+
+    mutable std::atomic_size_t m_hierarchyGeneration = 0;
+    internal::SharedTable<internal::AncestorTable> m_ancestorTable;
+
+    static inline std::atomic_size_t m_classCount = 0;
+
     friend class rtti::MetaClass;
 };
 
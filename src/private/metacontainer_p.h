@@ -24,6 +24,10 @@ public:
     bool add(MetaItem *value);
     MetaItem* get(std::size_t index) const;
     MetaItem* get(std::string_view name) const;
+    MetaItem* get(symbol name) const;
+    // Exact signature or bare name of method, which gives first registered overload
+    MetaItem* find(std::string_view name) const;
+    MetaItem* find(symbol name) const;
     std::size_t size() const;
     template<typename F> void for_each(F &&func) const;
 
@@ -31,6 +35,11 @@ private:
     mutable std::shared_mutex m_lock;
     std::vector<item_t> m_items;
     std::unordered_map<std::string_view, std::size_t> m_names;
+    // Bare name of signature "name(args...)" to indexes of its overloads in registration order
+    std::unordered_map<std::string_view, std::vector<std::size_t>> m_overloads;
+    // Symbol id of name and of bare name of method to index of item
+    std::unordered_map<std::size_t, std::size_t> m_symbols;
+    std::unordered_map<std::size_t, std::size_t> m_overloadSymbols;
 };
 
 template<typename F>
@@ -57,9 +66,22 @@ public:
     { return m_lists[category]->size(); }
     MetaItem* item(MetaCategory category, std::string_view name) const
     { return m_lists[category]->get(name); }
+    MetaItem* item(MetaCategory category, symbol name) const
+    { return m_lists[category]->get(name); }
+
+    // Deferred definition has run or was never set
+    bool defined() const noexcept
+    { return !m_deferredDefine_lock.load(std::memory_order_acquire) && !m_deferredDefine; }
 protected:
+    // Called after method or property is added
+    virtual void definitionChanged() const
+    {}
     bool addItem(MetaItem *value);
     MetaItem* findMethod(MetaCategory category, std::string_view name) const;
+    MetaItem* findMethod(MetaCategory category, symbol name) const;
+    template<typename F>
+    void for_each(MetaCategory category, F &&func) const
+    { m_lists[category]->for_each(std::forward<F>(func)); }
 
 private:
     internal::MetaItemList m_namespaces;
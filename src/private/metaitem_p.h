@@ -4,6 +4,7 @@
 #include <rtti/metaitem.h>
 #include <rtti/variant.h>
 
+#include <mutex>
 #include <shared_mutex>
 #include <vector>
 #include <map>
@@ -32,6 +33,7 @@ namespace internal {
         void set(std::string_view name, T &&value);
         variant const &get(std::size_t index) const;
         variant const &get(std::string_view name) const;
+        variant const &get(symbol name) const;
         std::string const &name(std::size_t index) const;
 
         std::size_t size() const
@@ -47,6 +49,7 @@ namespace internal {
         mutable std::shared_mutex m_lock;
         std::vector<std::unique_ptr<named_variant>> m_items;
         std::unordered_map<std::string_view, std::size_t> m_names;
+        std::unordered_map<std::size_t, std::size_t> m_symbols;
     };
 
     template<typename T>
@@ -60,6 +63,7 @@ namespace internal {
         {
             auto &item = m_items.emplace_back(new named_variant{name, std::forward<T>(value)});
             m_names.emplace(item->name, m_items.size() - 1);
+            m_symbols.emplace(symbol{item->name}.id(), m_items.size() - 1);
         }
         else
         {
@@ -1,38 +1,172 @@
 ﻿#ifndef METATYPE_P_H
 #define METATYPE_P_H
 
-#include <bitset>
 #include <atomic>
+#include <utility>
+#include <vector>
 
 #include <rtti/metatype.h>
 #include <rtti/defines.h>
 
 namespace rtti {
 
-struct RTTI_PRIVATE TypeInfo
+namespace internal {
+
+struct RTTI_PRIVATE ConverterEntry
+{
+    TypeInfo const *to;
+    ConvertFunctionBase const *func;
+};
+
+// Chain of converters resolved through the conversion graph.
+// Empty chain means there is no path.
+struct RTTI_PRIVATE ConverterPath
+{
+    TypeInfo const *to;
+    std::vector<ConverterEntry> steps;
+};
+
+// Converters registered for one decayed source type. Row is never replaced:
+// registered converters and memoized paths are append-only lists, so readers
+// don't lock and nothing they may be reading is ever freed while registry lives.
+class RTTI_PRIVATE ConverterRow
 {
-    using const_bitset_t = std::bitset<16>;
+public:
+    struct Item
+    {
+        TypeInfo const *to;
+        // Null after converter is removed
+        std::atomic<ConvertFunctionBase const*> func;
+        std::atomic<Item*> next = nullptr;
+    };
+
+    ConverterRow() = default;
+    ConverterRow(ConverterRow const&) = delete;
+    ConverterRow& operator=(ConverterRow const&) = delete;
+
+    ~ConverterRow()
+    {
+        for (auto *item = m_items.load(std::memory_order_relaxed); item;)
+            delete std::exchange(item, item->next.load(std::memory_order_relaxed));
+        for (auto *path = m_paths.load(std::memory_order_relaxed); path;)
+            delete std::exchange(path, path->next);
+    }
+
+    ConvertFunctionBase const* find(TypeInfo const *to) const noexcept
+    {
+        if (auto *item = findItem(to))
+            return item->func.load(std::memory_order_acquire);
+        return nullptr;
+    }
+
+    template<typename F>
+    void for_each(F &&func) const
+    {
+        for (auto *item = m_items.load(std::memory_order_acquire); item;
+             item = item->next.load(std::memory_order_acquire))
+            if (auto *converter = item->func.load(std::memory_order_acquire))
+                func(item->to, converter);
+    }
 
+    // Called under registry lock, keeps registration order
+    bool add(TypeInfo const *to, ConvertFunctionBase const *func)
+    {
+        if (auto *item = findItem(to))
+        {
+            ConvertFunctionBase const *expected = nullptr;
+            return item->func.compare_exchange_strong(expected, func, std::memory_order_acq_rel);
+        }
+
+        auto *item = new Item{to, func};
+        if (m_tail)
+            m_tail->next.store(item, std::memory_order_release);
+        else
+            m_items.store(item, std::memory_order_release);
+        m_tail = item;
+        return true;
+    }
+
+    // Called under registry lock
+    bool remove(TypeInfo const *to)
+    {
+        if (auto *item = findItem(to))
+            return (item->func.exchange(nullptr, std::memory_order_acq_rel) != nullptr);
+        return false;
+    }
+
+    // Most recent memoized path, if it was resolved for current graph version
+    ConverterPath const* findPath(TypeInfo const *to, std::uint32_t version) const noexcept
+    {
+        for (auto *path = m_paths.load(std::memory_order_acquire); path; path = path->next)
+            if (path->value.to == to)
+                return (path->version == version ? &path->value : nullptr);
+        return nullptr;
+    }
+
+    // Called under registry lock. Outdated path of the same type stays in list
+    // shadowed by the new one, graph changes only with converter registration.
+    ConverterPath const* addPath(ConverterPath value, std::uint32_t version)
+    {
+        auto *path = new Path{std::move(value), version, m_paths.load(std::memory_order_relaxed)};
+        m_paths.store(path, std::memory_order_release);
+        return &path->value;
+    }
+
+private:
+    struct Path
+    {
+        ConverterPath value;
+        std::uint32_t version;
+        Path const *next;
+    };
+
+    Item* findItem(TypeInfo const *to) const noexcept
+    {
+        for (auto *item = m_items.load(std::memory_order_acquire); item;
+             item = item->next.load(std::memory_order_acquire))
+            if (item->to == to)
+                return item;
+        return nullptr;
+    }
+
+    std::atomic<Item*> m_items = nullptr;
+    Item *m_tail = nullptr;
+    std::atomic<Path const*> m_paths = nullptr;
+};
+
+} // namespace internal
+
+struct RTTI_PRIVATE TypeInfo
+{
     std::string_view const name;
     std::size_t const size;
+    std::size_t const align;
     MetaType_ID const decay;
     std::uint16_t const arity;
     std::uint16_t const const_mask;
     TypeFlags const flags;
     metatype_manager_t const *manager;
+    // Dense registration order, starting from 1 (0 is reserved for void)
+    std::uint32_t const index;
 
     mutable std::atomic<MetaClass *> metaClass = nullptr;
+    // Valid only for decayed types
+    mutable std::atomic<internal::ConverterRow *> converters = nullptr;
+    // Valid only for decayed types
+    mutable std::atomic<MemoryResource *> resource = nullptr;
 
-    constexpr TypeInfo(std::string_view name, std::size_t size, MetaType_ID decay,
+    constexpr TypeInfo(std::string_view name, std::size_t size, std::size_t align, MetaType_ID decay,
                        std::uint16_t arity, std::uint16_t const_mask, TypeFlags flags,
-                       metatype_manager_t const *manager)
+                       metatype_manager_t const *manager, std::uint32_t index)
         : name{name}
         , size{size}
+        , align{align}
         , decay{decay.valid() ? decay : MetaType_ID{reinterpret_cast<MetaType_ID::type>(this)}}
         , arity{arity}
         , const_mask{const_mask}
         , flags{flags}
         , manager{manager}
+        , index{index}
     {}
 };
 
@@ -0,0 +1,77 @@
+﻿#ifndef RECLAIM_P_H
+#define RECLAIM_P_H
+
+#include <rtti/export.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace rtti {
+namespace internal {
+
+struct ThreadEpoch;
+
+// Marks current thread as reading tables published for lock-free lookup.
+// Table retired while reader exists is freed only after reader is gone.
+class RTTI_PRIVATE ReadGuard
+{
+public:
+    ReadGuard() noexcept;
+    ReadGuard(ReadGuard const&) = delete;
+    ReadGuard& operator=(ReadGuard const&) = delete;
+    ~ReadGuard();
+
+private:
+    ThreadEpoch *m_epoch;
+};
+
+// Frees value once no thread that could have loaded it is reading,
+// value should be unreachable for new readers already
+RTTI_PRIVATE void retire(void const *value, void (*deleter)(void const*));
+
+template<typename T>
+void retire(T const *value)
+{
+    retire(value, [](void const *ptr) { delete static_cast<T const*>(ptr); });
+}
+
+// Lookup table read without locking under ReadGuard, replaced tables are retired
+template<typename T>
+class RTTI_PRIVATE SharedTable
+{
+public:
+    SharedTable() = default;
+    SharedTable(SharedTable const&) = delete;
+    SharedTable& operator=(SharedTable const&) = delete;
+    ~SharedTable()
+    { delete m_current.load(std::memory_order_relaxed); }
+
+    T const* get(ReadGuard const&) const noexcept
+    { return m_current.load(); }
+
+    // Table is published unless table of the same or later generation already is,
+    // result is current table
+    T const* publish(std::unique_ptr<T> table, ReadGuard const&) const
+    {
+        std::lock_guard lock{m_lock};
+        auto *current = m_current.load(std::memory_order_relaxed);
+        if (current && current->generation >= table->generation)
+            return current;
+
+        m_current.store(table.get());
+        if (current)
+            retire(current);
+        return table.release();
+    }
+
+private:
+    mutable std::atomic<T const*> m_current = nullptr;
+    mutable std::mutex m_lock;
+};
+
+} // namespace internal
+} // namespace rtti
+
+#endif // RECLAIM_P_H
@@ -0,0 +1,29 @@
+﻿#ifndef VARIANT_P_H
+#define VARIANT_P_H
+
+#include <rtti/variant.h>
+
+namespace rtti {
+namespace internal {
+
+struct RTTI_PRIVATE variant_access
+{
+    // Pointer to decayed value, array storage is dereferenced
+    static void const* data(variant const &value) noexcept
+    {
+        auto ptr = value.raw_data_ptr();
+        if (MetaType{value.internalTypeId()}.isArray())
+            ptr = *reinterpret_cast<void const *const *>(ptr);
+        return ptr;
+    }
+
+    static MetaType decayType(variant const &value) noexcept
+    {
+        return MetaType{MetaType{value.internalTypeId()}.decayId()};
+    }
+};
+
+} // namespace internal
+} // namespace rtti
+
+#endif // VARIANT_P_H
@@ -0,0 +1,174 @@
+﻿#include "reclaim_p.h"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/membarrier.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace rtti {
+namespace internal {
+
+// Epoch announced by reading thread, zero while it isn't reading
+struct ThreadEpoch
+{
+    std::atomic<std::uint64_t> value = 0;
+    std::uint32_t depth = 0;
+};
+
+namespace {
+
+struct Retired
+{
+    void const *value;
+    void (*deleter)(void const*);
+    std::uint64_t epoch;
+};
+
+// Retired values are freed when every reading thread has announced later epoch
+class RTTI_PRIVATE EpochRegistry
+{
+public:
+    EpochRegistry()
+    {
+#if defined(__linux__)
+        // Readers skip the fence, retire() issues it on their behalf
+        m_asymmetric = (syscall(__NR_membarrier, MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED, 0, 0) == 0);
+#endif
+    }
+
+    std::uint64_t epoch() const noexcept
+    { return m_epoch.load(std::memory_order_acquire); }
+
+    bool asymmetric() const noexcept
+    { return m_asymmetric; }
+
+    ThreadEpoch* acquire()
+    {
+        std::lock_guard lock{m_lock};
+        if (!m_orphans.empty())
+        {
+            auto *result = m_orphans.back();
+            m_orphans.pop_back();
+            return result;
+        }
+        return m_threads.emplace_back(new ThreadEpoch).get();
+    }
+
+    void release(ThreadEpoch *thread)
+    {
+        std::lock_guard lock{m_lock};
+        m_orphans.push_back(thread);
+    }
+
+    void retire(void const *value, void (*deleter)(void const*))
+    {
+        std::lock_guard lock{m_lock};
+        m_retired.push_back({value, deleter, m_epoch.fetch_add(1)});
+        heavyFence();
+
+        auto oldest = std::numeric_limits<std::uint64_t>::max();
+        for (auto const &thread: m_threads)
+            if (auto value = thread->value.load())
+                oldest = std::min(oldest, value);
+
+        auto last = std::partition(std::begin(m_retired), std::end(m_retired),
+                                   [oldest](auto const &item) { return item.epoch >= oldest; });
+        for (auto it = last; it != std::end(m_retired); ++it)
+            it->deleter(it->value);
+        m_retired.erase(last, std::end(m_retired));
+    }
+
+private:
+    // Pairs with compiler-only fence of readers
+    void heavyFence() const noexcept
+    {
+#if defined(__linux__)
+        if (m_asymmetric && syscall(__NR_membarrier, MEMBARRIER_CMD_PRIVATE_EXPEDITED, 0, 0) == 0)
+            return;
+#endif
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+
+    bool m_asymmetric = false;
+    std::mutex m_lock;
+    // Zero means thread isn't reading
+    std::atomic<std::uint64_t> m_epoch = 1;
+    std::vector<std::unique_ptr<ThreadEpoch>> m_threads;
+    std::vector<ThreadEpoch*> m_orphans;
+    std::vector<Retired> m_retired;
+};
+
+// Intentionally never destroyed, lookups may run during static destruction
+EpochRegistry* epochRegistry()
+{
+    static auto *result = new EpochRegistry;
+    return result;
+}
+
+thread_local ThreadEpoch *t_epoch = nullptr;
+thread_local bool t_exited = false;
+
+struct ThreadEpochHolder
+{
+    ~ThreadEpochHolder()
+    {
+        epochRegistry()->release(epoch);
+        t_epoch = nullptr;
+        t_exited = true;
+    }
+
+    ThreadEpoch *epoch;
+};
+
+ThreadEpoch* currentEpoch()
+{
+    if (!t_epoch)
+    {
+        if (t_exited)
+            t_epoch = epochRegistry()->acquire();
+        else
+        {
+            thread_local ThreadEpochHolder holder{epochRegistry()->acquire()};
+            t_epoch = holder.epoch;
+        }
+    }
+    return t_epoch;
+}
+
+} // namespace
+
+ReadGuard::ReadGuard() noexcept
+    : m_epoch{currentEpoch()}
+{
+    // Table pointers are loaded after epoch is visible to retire()
+    if (m_epoch->depth++ == 0)
+    {
+        auto *registry = epochRegistry();
+        if (registry->asymmetric())
+        {
+            m_epoch->value.store(registry->epoch(), std::memory_order_relaxed);
+            std::atomic_signal_fence(std::memory_order_seq_cst);
+        }
+        else
+            m_epoch->value.exchange(registry->epoch());
+    }
+}
+
+ReadGuard::~ReadGuard()
+{
+    if (--m_epoch->depth == 0)
+        m_epoch->value.store(0, std::memory_order_release);
+}
+
+void retire(void const *value, void (*deleter)(void const*))
+{
+    epochRegistry()->retire(value, deleter);
+}
+
+} // namespace internal
+} // namespace rtti
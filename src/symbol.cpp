@@ -0,0 +1,70 @@
+﻿#include <rtti/symbol.h>
+
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+namespace rtti {
+
+namespace {
+
+class SymbolTable
+{
+public:
+    static SymbolTable& instance()
+    {
+        static SymbolTable result;
+        return result;
+    }
+
+    internal::symbol_entry const* find(std::string_view name) const
+    {
+        std::shared_lock lock{m_lock};
+        auto search = m_entries.find(name);
+        return (search != std::end(m_entries) ? search->second : nullptr);
+    }
+
+    internal::symbol_entry const* insert(std::string_view name)
+    {
+        if (auto result = find(name))
+            return result;
+
+        std::unique_lock lock{m_lock};
+        if (auto search = m_entries.find(name); search != std::end(m_entries))
+            return search->second;
+
+        auto &text = m_names.emplace_back(name);
+        auto &entry = m_items.emplace_back(internal::symbol_entry{
+            text, std::hash<std::string_view>{}(text), m_items.size() + 1});
+        m_entries.emplace(entry.name, &entry);
+        return &entry;
+    }
+
+private:
+    SymbolTable() = default;
+
+    mutable std::shared_mutex m_lock;
+    // deque keeps references valid on growth
+    std::deque<std::string> m_names;
+    std::deque<internal::symbol_entry> m_items;
+    std::unordered_map<std::string_view, internal::symbol_entry const*> m_entries;
+};
+
+} // namespace
+
+symbol::symbol(std::string_view name)
+{
+    if (!name.empty())
+        m_entry = SymbolTable::instance().insert(name);
+}
+
+symbol symbol::find(std::string_view name)
+{
+    if (name.empty())
+        return symbol{};
+    return symbol{SymbolTable::instance().find(name)};
+}
+
+} // namespace rtti
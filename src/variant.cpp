@@ -1,19 +1,38 @@
-﻿#include <rtti/variant.h>
+﻿#include "variant_p.h"
 
 namespace rtti {
 
+namespace internal {
+
+template<>
+variant_function_table const* variant_function_table_for<void>() noexcept
+{
+    static auto const result = variant_function_table{
+        [] (type_attribute) noexcept -> MetaType_ID { return MetaType_ID(); },
+        [] (variant_type_storage const&) noexcept -> void const* { return nullptr; },
+        [] (void const*, variant_type_storage&) noexcept {},
+        [] (void*, variant_type_storage&) noexcept {},
+        [] (variant_type_storage const&, variant_type_storage&) noexcept {},
+        [] (variant_type_storage&, variant_type_storage&) noexcept {},
+        [] (variant_type_storage&) noexcept {},
+        [] (variant_type_storage const&, void const*) noexcept -> bool { return false; },
+        [] (variant_type_storage const&) noexcept -> std::size_t { return 0; },
+        [] (variant_type_storage const&) noexcept { return ClassInfo(); },
+        nullptr,
+        true,
+        true
+    };
+    return &result;
+}
+
+} // namespace internal
+
 variant const variant::empty_variant = {};
 
 variant::variant() noexcept
     : manager(internal::variant_function_table_for<void>())
 {}
 
-variant::variant(variant const &other)
-    : manager{other.manager}
-{
-    manager->f_copy(other.storage, storage);
-}
-
 variant& variant::operator=(variant const &other)
 {
     if (this != &other)
@@ -21,12 +40,6 @@ variant& variant::operator=(variant const &other)
     return *this;
 }
 
-variant::variant(variant &&other) noexcept
-    : manager(internal::variant_function_table_for<void>())
-{
-    swap(other);
-}
-
 variant& variant::operator=(variant &&other) noexcept
 {
     if (this != &other)
@@ -34,15 +47,17 @@ variant& variant::operator=(variant &&other) noexcept
     return *this;
 }
 
-variant::~variant() noexcept
-{
-    clear();
-}
-
 void variant::swap(variant &other) noexcept
 {
     using std::swap;
 
+    if (manager->trivially_relocatable && other.manager->trivially_relocatable)
+    {
+        swap(manager, other.manager);
+        swap(storage, other.storage);
+        return;
+    }
+
     auto thisEmpty  = this->empty();
     auto otherEmpty = other.empty();
     if (thisEmpty && otherEmpty)
@@ -78,7 +93,8 @@ void variant::swap(variant &other) noexcept
 
 void variant::clear() noexcept
 {
-    manager->f_destroy(storage);
+    if (!manager->trivially_copyable)
+        manager->f_destroy(storage);
     manager = internal::variant_function_table_for<void>();
     storage = storage_t{};
 }
@@ -88,6 +104,31 @@ bool variant::empty() const noexcept
     return (manager == internal::variant_function_table_for<void>());
 }
 
+void variant::throw_cast_error(variant_error error, MetaType_ID fromId, MetaType_ID toId)
+{
+    using namespace std::literals;
+
+    switch (error) {
+    case variant_error::EMPTY:
+        throw bad_variant_cast{"Variant is empty"};
+    case variant_error::SUBOBJECT_POINTER:
+        throw bad_variant_cast{"Reference to sub-object pointers isn't supported"};
+    default:
+        throw bad_variant_cast{"Incompatible types: "s + MetaType{fromId}.typeName() +
+                               " -> " + MetaType{toId}.typeName()};
+    }
+}
+
+void variant::throw_convert_error(variant_error error, MetaType_ID fromId, MetaType_ID toId)
+{
+    using namespace std::literals;
+
+    if (error == variant_error::EMPTY)
+        throw bad_variant_convert{"Variant is empty"};
+    throw bad_variant_convert{"Incompatible types: "s + MetaType{fromId}.typeName() +
+                              " -> " + MetaType{toId}.typeName()};
+}
+
 bool variant::operator==(variant const &value) const
 {
     if (empty() && value.empty())
@@ -95,6 +136,14 @@ bool variant::operator==(variant const &value) const
     if (empty() || value.empty())
         return false;
 
+    if (manager == value.manager)
+    {
+        auto ptr = value.raw_data_ptr();
+        if (MetaType{internalTypeId()}.isArray())
+            ptr = *reinterpret_cast<void const *const *>(ptr);
+        return manager->f_compare_eq(storage, ptr);
+    }
+
     auto mt_left  = MetaType{this->internalTypeId(type_attribute::LREF_CONST)};
     auto mt_right = MetaType{value.internalTypeId(type_attribute::LREF_CONST)};
 
@@ -113,23 +162,56 @@ bool variant::operator==(variant const &value) const
     return false;
 }
 
-variant variant::get_property(std::string_view name) const
+bool variant::operator<(variant const &value) const
+{
+    using internal::variant_access;
+
+    if (value.empty())
+        return false;
+    if (empty())
+        return true;
+
+    auto mt_left  = variant_access::decayType(*this);
+    auto mt_right = variant_access::decayType(value);
+    if (mt_left.index() != mt_right.index())
+        return mt_left.index() < mt_right.index();
+
+    return mt_left.less(variant_access::data(*this), variant_access::data(value));
+}
+
+namespace {
+
+template<typename Name>
+variant get_property_imp(variant const &self, Name name)
 {
     using namespace std::literals;
 
-    auto type = MetaType{typeId()};
+    auto type = MetaType{self.typeId()};
     if (type.isClass() || type.isClassPtr())
     {
-        if (auto *mt_class = this->metaClass())
+        if (auto *mt_class = self.metaClass())
         {
             if (auto *mt_property = mt_class->getProperty(name))
-                return mt_property->get(*this);
+                return mt_property->get(self);
 
-            throw runtime_error{"Property ["s + name + "] isn't found in class T = " + type.typeName()};
+            throw runtime_error{"Property ["s + std::string_view{name} + "] isn't found in class T = " +
+                                type.typeName()};
         }
         throw runtime_error{"Class T = "s + type.typeName() + " isn't registered"};
     }
     throw runtime_error{"Type T = "s + type.typeName() + " isn't Class or ClassPtr"};
 }
 
+} // namespace
+
+variant variant::get_property(std::string_view name) const
+{
+    return get_property_imp(*this, name);
+}
+
+variant variant::get_property(symbol name) const
+{
+    return get_property_imp(*this, name);
+}
+
 } // namespace rtti
@@ -0,0 +1,304 @@
+﻿#include <rtti/variant_column.h>
+
+#include <cstring>
+#include <limits>
+#include <new>
+#include <stdexcept>
+
+namespace rtti {
+
+namespace {
+
+void* allocateBuffer(MetaType type, std::size_t count)
+{
+    auto size = type.typeSize();
+    if (size && count > std::numeric_limits<std::size_t>::max() / size)
+        throw std::length_error{"Column capacity is too large"};
+    return ::operator new(count * size, std::align_val_t{type.typeAlign()});
+}
+
+void deallocateBuffer(MetaType type, void *buffer) noexcept
+{
+    if (buffer)
+        ::operator delete(buffer, std::align_val_t{type.typeAlign()});
+}
+
+// Trivial types are relocated by memmove and need no destruction
+bool isTrivial(MetaType type) noexcept
+{
+    return ((type.typeFlags() & TypeFlags::Trivial) == TypeFlags::Trivial);
+}
+
+} // namespace
+
+variant_column::variant_column(MetaType type, table_t *value, table_t *ref, table_t *cref) noexcept
+    : m_type{type}
+    , m_value{value}
+    , m_ref{ref}
+    , m_cref{cref}
+{}
+
+variant_column::variant_column(variant_column const &other)
+    : m_type{other.m_type}
+    , m_value{other.m_value}
+    , m_ref{other.m_ref}
+    , m_cref{other.m_cref}
+{
+    if (other.m_size)
+    {
+        auto *buffer = allocateBuffer(m_type, other.m_size);
+        try
+        {
+            m_type.copy_n(other.m_data, buffer, other.m_size);
+        }
+        catch (...)
+        {
+            deallocateBuffer(m_type, buffer);
+            throw;
+        }
+        m_data = buffer;
+        m_size = m_capacity = other.m_size;
+    }
+}
+
+variant_column& variant_column::operator=(variant_column const &other)
+{
+    if (this != &other)
+    {
+        auto copy = other;
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
+variant_column::variant_column(variant_column &&other) noexcept
+    : m_type{other.m_type}
+    , m_value{other.m_value}
+    , m_ref{other.m_ref}
+    , m_cref{other.m_cref}
+    , m_data{other.m_data}
+    , m_size{other.m_size}
+    , m_capacity{other.m_capacity}
+{
+    other.m_data = nullptr;
+    other.m_size = other.m_capacity = 0;
+}
+
+variant_column& variant_column::operator=(variant_column &&other) noexcept
+{
+    if (this != &other)
+    {
+        clear();
+        deallocateBuffer(m_type, m_data);
+
+        m_type = other.m_type;
+        m_value = other.m_value;
+        m_ref = other.m_ref;
+        m_cref = other.m_cref;
+        m_data = other.m_data;
+        m_size = other.m_size;
+        m_capacity = other.m_capacity;
+
+        other.m_data = nullptr;
+        other.m_size = other.m_capacity = 0;
+    }
+    return *this;
+}
+
+variant_column::~variant_column() noexcept
+{
+    clear();
+    deallocateBuffer(m_type, m_data);
+}
+
+void variant_column::reserve(std::size_t count)
+{
+    if (count > m_capacity)
+        reallocate(count);
+}
+
+void variant_column::resize(std::size_t count)
+{
+    if (count < m_size)
+    {
+        m_type.destroy_n(at(count), m_size - count);
+        m_size = count;
+    }
+    else if (count > m_size)
+    {
+        reserve(count);
+        m_type.construct_n(at(m_size), count - m_size);
+        m_size = count;
+    }
+}
+
+void variant_column::clear() noexcept
+{
+    m_type.destroy_n(m_data, m_size);
+    m_size = 0;
+}
+
+void variant_column::push_back(variant const &value)
+{
+    using namespace std::literals;
+
+    if (value.empty())
+        throw bad_variant_convert{"Variant is empty"};
+
+    auto from = MetaType{value.typeId()};
+    auto *source = value.raw_data_ptr();
+
+    // Value may refer to element of this column, so new element is
+    // constructed before existing ones are moved to grown buffer
+    auto capacity = (m_size == m_capacity) ? grow(m_size + 1) : m_capacity;
+    auto *buffer = (capacity != m_capacity) ? allocateBuffer(m_type, capacity) : m_data;
+    auto *slot = static_cast<char*>(buffer) + m_size * m_type.typeSize();
+
+    try
+    {
+        if (from.decayId() == m_type.typeId())
+            m_type.copy_n(source, slot, 1);
+        else if (!MetaType::convert(source, from, slot, m_type))
+            throw bad_variant_convert{"Incompatible types: "s + from.typeName() + " -> " + m_type.typeName()};
+
+        if (buffer != m_data)
+        {
+            try
+            {
+                m_type.move_n(m_data, buffer, m_size);
+            }
+            catch (...)
+            {
+                m_type.destroy_n(slot, 1);
+                throw;
+            }
+        }
+    }
+    catch (...)
+    {
+        if (buffer != m_data)
+            deallocateBuffer(m_type, buffer);
+        throw;
+    }
+
+    if (buffer != m_data)
+    {
+        m_type.destroy_n(m_data, m_size);
+        deallocateBuffer(m_type, m_data);
+        m_data = buffer;
+        m_capacity = capacity;
+    }
+    ++m_size;
+}
+
+void variant_column::erase(std::size_t index)
+{
+    erase(index, index + 1);
+}
+
+void variant_column::erase(std::size_t first, std::size_t last)
+{
+    if (first >= last)
+        return;
+    checkIndex(last - 1);
+
+    auto count = last - first;
+    auto size = m_type.typeSize();
+    if (isTrivial(m_type))
+    {
+        std::memmove(at(first), at(last), (m_size - last) * size);
+        m_size -= count;
+        return;
+    }
+
+    // Size always covers only live prefix, if move throws the rest of tail is dropped
+    m_type.destroy_n(at(first), count);
+    auto end = m_size;
+    auto index = last;
+    m_size = first;
+    try
+    {
+        for (; index < end; ++index)
+        {
+            m_type.move_n(at(index), at(m_size), 1);
+            m_type.destroy_n(at(index), 1);
+            ++m_size;
+        }
+    }
+    catch (...)
+    {
+        m_type.destroy_n(at(index), end - index);
+        throw;
+    }
+}
+
+variant variant_column::value(std::size_t index) const
+{
+    checkIndex(index);
+
+    variant result;
+    m_value->f_copy_construct(at(index), result.storage);
+    result.manager = m_value;
+    return result;
+}
+
+variant variant_column::ref(std::size_t index)
+{
+    checkIndex(index);
+
+    variant result;
+    result.storage.ptr = at(index);
+    result.manager = m_ref;
+    return result;
+}
+
+variant variant_column::cref(std::size_t index) const
+{
+    checkIndex(index);
+
+    variant result;
+    result.storage.ptr = at(index);
+    result.manager = m_cref;
+    return result;
+}
+
+std::size_t variant_column::grow(std::size_t count) const noexcept
+{
+    return std::max({count, m_capacity * 2, std::size_t{8}});
+}
+
+void variant_column::reallocate(std::size_t capacity)
+{
+    auto *buffer = allocateBuffer(m_type, capacity);
+    try
+    {
+        m_type.move_n(m_data, buffer, m_size);
+    }
+    catch (...)
+    {
+        deallocateBuffer(m_type, buffer);
+        throw;
+    }
+
+    m_type.destroy_n(m_data, m_size);
+    deallocateBuffer(m_type, m_data);
+    m_data = buffer;
+    m_capacity = capacity;
+}
+
+void variant_column::checkType(MetaType_ID typeId) const
+{
+    using namespace std::literals;
+
+    if (typeId != m_type.typeId())
+        throw bad_variant_cast{"Incompatible types: "s + m_type.typeName() + " -> " +
+                               MetaType{typeId}.typeName()};
+}
+
+void variant_column::checkIndex(std::size_t index) const
+{
+    if (index >= m_size)
+        throw runtime_error{"Column index is out of range"};
+}
+
+} // namespace rtti
@@ -1,5 +1,7 @@
 ﻿#include <rtti/metadefine.h>
 
+#include <cstring>
+
 std::string g_string = "";
 std::string const gro_string = "Hello, World!";
 
@@ -20,6 +22,27 @@ int strToInt(std::string const &value, bool &ok)
     return to;
 }
 
+long sumOfTwelve(int a0, int a1, int a2, int a3, int a4, int a5,
+                 int a6, int a7, int a8, int a9, int a10, long const &a11)
+{
+    return a0 + a1 + a2 + a3 + a4 + a5 + a6 + a7 + a8 + a9 + a10 + a11;
+}
+
+std::size_t lenRef(char const* const &value)
+{
+    return std::strlen(value);
+}
+
+int overloaded(int value)
+{
+    return value;
+}
+
+double overloaded(double value)
+{
+    return value * 2;
+}
+
 template<typename From>
 bool register_toString_converter()
 {
@@ -66,6 +89,10 @@ void register_global_ns()
         ._property("gro_string", &gro_string)
         ._method("intToStr", &intToStr)
         ._method("strToInt", &strToInt)
+        ._method("sumOfTwelve", &sumOfTwelve)
+        ._method("lenRef", &lenRef)
+        ._method<int(*)(int)>("overloaded", &overloaded)
+        ._method<double(*)(double)>("overloaded", &overloaded)
         ._enum<operation>("operation")
             ._element("add", operation::add)
             ._element("subtract", operation::subtract)
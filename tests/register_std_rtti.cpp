@@ -48,7 +48,7 @@ void define_std_string(rtti::meta_define<std::basic_string<Char>> define)
         .template _method("capacity", &T::capacity)
         .template _method("empty", &T::empty)
         .template _method("clear", &T::clear)
-        .template _method("reserve", &T::reserve)
+        .template _method<void (T::*)(size_type)>("reserve", &T::reserve)
 
         .template _method("c_str", &T::c_str)
 
@@ -0,0 +1,200 @@
+﻿#define DOCTEST_CONFIG_VOID_CAST_EXPRESSIONS
+#include <doctest/doctest.h>
+#include <rtti/algorithm.h>
+
+#include <algorithm>
+#include <map>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace {
+
+struct Unordered
+{
+    int value = 0;
+};
+
+// Ordered by key only, order shows whether sort is stable
+struct Keyed
+{
+    int key = 0;
+    int order = 0;
+
+    bool operator==(Keyed const &other) const
+    { return key == other.key && order == other.order; }
+    bool operator<(Keyed const &other) const
+    { return key < other.key; }
+};
+
+// Comparison always fails
+struct Touchy
+{
+    int value = 0;
+
+    bool operator==(Touchy const &other) const
+    { return value == other.value; }
+    bool operator<(Touchy const&) const
+    { throw std::runtime_error{"not comparable"}; }
+};
+
+struct Opaque
+{
+    int value = 0;
+
+    bool operator==(Opaque const &other) const
+    { return value == other.value; }
+};
+
+} // namespace
+
+TEST_CASE("Variant ordering")
+{
+    using namespace std::literals;
+
+    REQUIRE(rtti::metaType<int>().isLtComparable());
+    REQUIRE(rtti::metaType<std::string const&>().isLtComparable());
+    REQUIRE_FALSE(rtti::metaType<Unordered>().isLtComparable());
+
+    // Element types decide ordering of std containers and wrappers
+    REQUIRE(rtti::metaType<std::vector<int>>().isLtComparable());
+    REQUIRE(rtti::metaType<std::map<std::string, int>>().isLtComparable());
+    REQUIRE_FALSE(rtti::metaType<std::vector<Opaque>>().isLtComparable());
+    REQUIRE_FALSE(rtti::metaType<std::vector<std::vector<Opaque>>>().isLtComparable());
+    REQUIRE_FALSE(rtti::metaType<std::map<int, Opaque>>().isLtComparable());
+    REQUIRE_FALSE(rtti::metaType<std::pair<int, Opaque>>().isLtComparable());
+    REQUIRE_FALSE(rtti::metaType<std::tuple<int, Opaque>>().isLtComparable());
+    REQUIRE_FALSE(rtti::metaType<std::optional<Opaque>>().isLtComparable());
+
+    auto opaque = std::vector<Opaque>{{1}};
+    rtti::variant value = opaque;
+    REQUIRE(value == rtti::variant{opaque});
+    REQUIRE_THROWS_AS(rtti::metaType<std::vector<Opaque>>().less(&opaque, &opaque), rtti::runtime_error);
+
+    auto one = 1, two = 2;
+    auto type = rtti::metaType<int>();
+    REQUIRE(type.less(&one, &two));
+    REQUIRE(type.compare(&one, &two) < 0);
+    REQUIRE(type.compare(&two, &one) > 0);
+    REQUIRE(type.compare(&one, &one) == 0);
+    REQUIRE_THROWS_AS(rtti::metaType<Unordered>().less(&one, &two), rtti::runtime_error);
+
+    REQUIRE(rtti::variant{1} < rtti::variant{2});
+    REQUIRE_FALSE(rtti::variant{2} < rtti::variant{1});
+    REQUIRE(rtti::variant{"a"s} < rtti::variant{"b"s});
+    REQUIRE(rtti::variant{} < rtti::variant{1});
+    REQUIRE_FALSE(rtti::variant{1} < rtti::variant{});
+
+    // Different types are ordered by registration index
+    auto int_first = rtti::metaType<int>().index() < rtti::metaType<std::string>().index();
+    REQUIRE((rtti::variant{5} < rtti::variant{"a"s}) == int_first);
+}
+
+TEST_CASE("Variant sort")
+{
+    using namespace std::literals;
+
+    auto make = []
+    {
+        std::mt19937 random{42};
+        std::vector<rtti::variant> result;
+        for (auto i = 0; i < 3000; ++i)
+        {
+            auto value = static_cast<int>(random() % 1000);
+            switch (i % 4) {
+            case 0: result.emplace_back(value); break;
+            case 1: result.emplace_back(std::to_string(value)); break;
+            case 2: result.emplace_back(Unordered{i}); break;
+            default: result.emplace_back(); break;
+            }
+        }
+        return result;
+    };
+
+    auto check = [](std::vector<rtti::variant> const &values)
+    {
+        for (std::size_t i = 1; i < values.size(); ++i)
+        {
+            auto const &prev = values[i - 1];
+            auto const &item = values[i];
+            if (prev.empty() || item.empty() || prev.typeId() != item.typeId())
+            {
+                REQUIRE_FALSE(item < prev);
+                continue;
+            }
+            if (prev.is<Unordered>())
+                // Stable for types without operator<
+                REQUIRE(prev.cref<Unordered>().value < item.cref<Unordered>().value);
+            else
+                REQUIRE_FALSE(item < prev);
+        }
+    };
+
+    auto values = make();
+    rtti::sort(values);
+    REQUIRE(values.size() == 3000);
+    REQUIRE(values.front().empty());
+    check(values);
+
+    auto parallel = make();
+    rtti::sort(rtti::par, parallel);
+    check(parallel);
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        if (values[i].is<Unordered>())
+            REQUIRE(values[i].cref<Unordered>().value == parallel[i].cref<Unordered>().value);
+        else
+            REQUIRE(values[i] == parallel[i]);
+    }
+}
+
+TEST_CASE("Variant parallel sort of single type")
+{
+    constexpr auto Count = 100'000;
+
+    std::mt19937 random{7};
+    std::vector<rtti::variant> values;
+    for (auto i = 0; i < Count; ++i)
+        values.emplace_back(Keyed{static_cast<int>(random() % 5000), i});
+
+    auto sequential = values;
+    rtti::sort(sequential);
+    auto stable = std::is_sorted(sequential.begin(), sequential.end(), [](auto const &lhs, auto const &rhs)
+    {
+        auto const &a = lhs.template cref<Keyed>();
+        auto const &b = rhs.template cref<Keyed>();
+        return a.key < b.key || (a.key == b.key && a.order < b.order);
+    });
+    REQUIRE(stable);
+
+    for (auto threads: {2u, 3u, 8u})
+    {
+        auto parallel = values;
+        rtti::sort(rtti::parallel_policy{threads}, parallel);
+        REQUIRE(parallel == sequential);
+    }
+}
+
+TEST_CASE("Variant parallel sort propagates exceptions")
+{
+    constexpr auto Count = 20'000;
+
+    std::vector<rtti::variant> values;
+    for (auto i = 0; i < Count; ++i)
+    {
+        values.emplace_back(Touchy{i});
+        values.emplace_back(Opaque{i});
+    }
+
+    REQUIRE_THROWS_AS(rtti::sort(values), std::runtime_error);
+    for (auto threads: {2u, 3u, 8u})
+    {
+        auto parallel = values;
+        REQUIRE_THROWS_AS(rtti::sort(rtti::parallel_policy{threads}, parallel), std::runtime_error);
+        REQUIRE(parallel.size() == values.size());
+    }
+}
@@ -0,0 +1,270 @@
+﻿#define DOCTEST_CONFIG_VOID_CAST_EXPRESSIONS
+#include <doctest/doctest.h>
+#include <rtti/variant.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+int alive = 0;
+
+struct Meters
+{
+    double value;
+};
+
+struct Feet
+{
+    double value;
+};
+
+struct Inches
+{
+    Inches(double value)
+        : value{value}
+    { ++alive; }
+    Inches(Inches const &other)
+        : value{other.value}
+    { ++alive; }
+    ~Inches()
+    { --alive; }
+
+    double value;
+};
+
+// Does not fit scratch buffer on stack
+struct Label
+{
+    Label(std::string value)
+        : value{std::move(value)}
+    { ++alive; }
+    Label(Label const &other)
+        : value{other.value}
+    { ++alive; }
+    ~Label()
+    { --alive; }
+
+    std::string value;
+    char padding[128] = {};
+};
+
+// Chain of four steps, first and third intermediate values share scratch buffer
+struct ChainSource
+{
+    double value;
+};
+
+struct ChainBlob
+{
+    double value;
+    char padding[2048];
+};
+
+struct ChainStep
+{
+    double value;
+};
+
+struct ChainWide
+{
+    alignas(1024) double value;
+};
+
+struct ChainResult
+{
+    double value;
+    bool aligned;
+};
+
+struct Fragile
+{
+    Fragile(int value)
+        : value{value}
+    { ++alive; }
+    Fragile(Fragile const &other)
+        : value{other.value}
+    {
+        if (value < 0)
+            throw std::runtime_error{"copy failed"};
+        ++alive;
+    }
+    ~Fragile()
+    { --alive; }
+
+    int value;
+};
+
+} // namespace
+
+TEST_CASE("Transitive converters")
+{
+    using rtti::MetaType;
+
+    REQUIRE(MetaType::registerConverter<Meters, Feet>([](Meters const &v) { return Feet{v.value * 3.25}; }));
+    REQUIRE(MetaType::registerConverter<Feet, Inches>([](Feet const &v) { return Inches{v.value * 12}; }));
+    REQUIRE(MetaType::registerConverter<Inches, Label>([](Inches const &v) { return Label{std::to_string(int(v.value))}; }));
+
+    SUBCASE("chaining is disabled by default")
+    {
+        REQUIRE_FALSE(MetaType::converterChaining());
+        REQUIRE_FALSE(MetaType::hasConverter<Meters, Inches>());
+        REQUIRE_THROWS_AS(rtti::variant{Meters{2}}.to<Inches>(), rtti::bad_variant_convert);
+    }
+
+    MetaType::setConverterChaining(true);
+
+    SUBCASE("path is resolved through intermediate types")
+    {
+        REQUIRE(MetaType::hasConverter<Meters, Inches>());
+        REQUIRE(MetaType::hasConverter<Meters, Label>());
+        REQUIRE_FALSE(MetaType::hasConverter<Label, Meters>());
+        REQUIRE_FALSE(MetaType::hasConverter<Inches, Meters>());
+
+        {
+            auto result = rtti::variant{Meters{2}}.to<Label>();
+            REQUIRE(result.value == "78");
+            // intermediate values are destroyed
+            REQUIRE(alive == 1);
+        }
+        REQUIRE(alive == 0);
+    }
+
+    SUBCASE("direct converter wins over chain")
+    {
+        REQUIRE(MetaType::registerConverter<Meters, Inches>([](Meters const &v) { return Inches{v.value}; }));
+        REQUIRE(rtti::variant{Meters{2}}.to<Inches>().value == 2);
+        MetaType::unregisterConverter<Meters, Inches>();
+        REQUIRE(rtti::variant{Meters{2}}.to<Inches>().value == 78);
+    }
+
+    SUBCASE("memoized path is dropped when graph changes")
+    {
+        REQUIRE(MetaType::hasConverter<Meters, Label>());
+        MetaType::unregisterConverter<Feet, Inches>();
+        REQUIRE_FALSE(MetaType::hasConverter<Meters, Label>());
+        REQUIRE_FALSE(MetaType::hasConverter<Meters, Inches>());
+        REQUIRE(MetaType::hasConverter<Meters, Feet>());
+    }
+
+    SUBCASE("scratch buffer respects alignment")
+    {
+        REQUIRE(MetaType::registerConverter<ChainSource, ChainBlob>([](ChainSource const &v) { return ChainBlob{v.value, {}}; }));
+        REQUIRE(MetaType::registerConverter<ChainBlob, ChainStep>([](ChainBlob const &v) { return ChainStep{v.value}; }));
+        REQUIRE(MetaType::registerConverter<ChainStep, ChainWide>([](ChainStep const &v) { return ChainWide{v.value}; }));
+        REQUIRE(MetaType::registerConverter<ChainWide, ChainResult>([](ChainWide const &v)
+        {
+            return ChainResult{v.value, reinterpret_cast<std::uintptr_t>(&v) % alignof(ChainWide) == 0};
+        }));
+
+        auto result = rtti::variant{ChainSource{2}}.to<ChainResult>();
+        REQUIRE(result.value == 2);
+        REQUIRE(result.aligned);
+
+        MetaType::unregisterConverter<ChainSource, ChainBlob>();
+        MetaType::unregisterConverter<ChainBlob, ChainStep>();
+        MetaType::unregisterConverter<ChainStep, ChainWide>();
+        MetaType::unregisterConverter<ChainWide, ChainResult>();
+    }
+
+    MetaType::setConverterChaining(false);
+    MetaType::unregisterConverter<Meters, Feet>();
+    MetaType::unregisterConverter<Feet, Inches>();
+    MetaType::unregisterConverter<Inches, Label>();
+    REQUIRE_FALSE(MetaType::hasConverter<Meters, Label>());
+}
+
+namespace {
+
+enum class Color: std::int32_t { Red = 1, Green = 2, Blue = 3 };
+
+} // namespace
+
+TEST_CASE("Bulk conversion")
+{
+    using rtti::MetaType;
+
+    SUBCASE("arithmetic types")
+    {
+        std::int32_t ints[] = {-2, 0, 7, 1 << 20, 123456};
+        double doubles[5] = {};
+        REQUIRE(MetaType::convert_n(ints, rtti::metaType<std::int32_t>(), doubles, rtti::metaType<double>(), 5));
+        for (auto i = 0; i < 5; ++i)
+            REQUIRE(doubles[i] == ints[i]);
+
+        float floats[] = {1.75f, -3.5f, 1e9f};
+        std::int64_t longs[3] = {};
+        REQUIRE(MetaType::convert_n(floats, rtti::metaType<float const&>(), longs, rtti::metaType<std::int64_t>(), 3));
+        REQUIRE(longs[0] == 1);
+        REQUIRE(longs[1] == -3);
+        REQUIRE(longs[2] == 1000000000);
+
+        bool flags[3] = {};
+        REQUIRE(MetaType::convert_n(ints, rtti::metaType<std::int32_t>(), flags, rtti::metaType<bool>(), 3));
+        REQUIRE(flags[0]);
+        REQUIRE_FALSE(flags[1]);
+        REQUIRE(flags[2]);
+    }
+
+    SUBCASE("enum to underlying type")
+    {
+        Color colors[] = {Color::Blue, Color::Red, Color::Green};
+        std::int32_t values[3] = {};
+        REQUIRE(MetaType::convert_n(colors, rtti::metaType<Color>(), values, rtti::metaType<std::int32_t>(), 3));
+        REQUIRE(values[0] == 3);
+        REQUIRE(values[1] == 1);
+        REQUIRE(values[2] == 2);
+
+        double doubles[3] = {};
+        REQUIRE_FALSE(MetaType::convert_n(colors, rtti::metaType<Color>(), doubles, rtti::metaType<double>(), 3));
+    }
+
+    SUBCASE("registered converter")
+    {
+        REQUIRE(MetaType::registerConverter<Feet, Inches>([](Feet const &v) { return Inches{v.value * 12}; }));
+        Feet feet[] = {{1}, {2}, {0.5}};
+        alignas(Inches) char buffer[3 * sizeof(Inches)];
+        REQUIRE(MetaType::convert_n(feet, rtti::metaType<Feet>(), buffer, rtti::metaType<Inches>(), 3));
+        auto *inches = reinterpret_cast<Inches*>(buffer);
+        REQUIRE(inches[0].value == 12);
+        REQUIRE(inches[1].value == 24);
+        REQUIRE(inches[2].value == 6);
+        REQUIRE(alive == 3);
+        for (auto i = 0; i < 3; ++i)
+            inches[i].~Inches();
+        MetaType::unregisterConverter<Feet, Inches>();
+
+        REQUIRE_FALSE(MetaType::convert_n(feet, rtti::metaType<Feet>(), buffer, rtti::metaType<Inches>(), 3));
+        REQUIRE(alive == 0);
+    }
+
+    SUBCASE("throwing converter")
+    {
+        REQUIRE(MetaType::registerConverter<Feet, Inches>([](Feet const &v, bool &ok)
+        {
+            if (v.value < 0)
+                throw std::invalid_argument{"negative length"};
+            ok = true;
+            return Inches{v.value * 12};
+        }));
+        Feet feet[] = {{1}, {2}, {-1}};
+        alignas(Inches) char buffer[3 * sizeof(Inches)];
+        REQUIRE_THROWS_AS(MetaType::convert_n(feet, rtti::metaType<Feet>(), buffer, rtti::metaType<Inches>(), 3),
+                          std::invalid_argument);
+        REQUIRE(alive == 0);
+        MetaType::unregisterConverter<Feet, Inches>();
+    }
+
+    SUBCASE("throwing copy")
+    {
+        {
+            Fragile values[] = {{1}, {2}, {-1}};
+            alignas(Fragile) char buffer[3 * sizeof(Fragile)];
+            REQUIRE_THROWS_AS(MetaType::convert_n(values, rtti::metaType<Fragile>(), buffer, rtti::metaType<Fragile>(), 3),
+                              std::runtime_error);
+            REQUIRE(alive == 3);
+        }
+        REQUIRE(alive == 0);
+    }
+}
@@ -2,6 +2,9 @@
 #include <doctest/doctest.h>
 #include <rtti/metadefine.h>
 
+#include <memory>
+#include <new>
+
 extern std::string g_string;
 extern std::string gro_string;
 
@@ -269,3 +272,71 @@ TEST_CASE("Test global namespace")
         }
     }
 }
+
+TEST_CASE("Test span based invocation")
+{
+    auto method = rtti::MetaNamespace::global()->getMethod("sumOfTwelve");
+    REQUIRE(method);
+
+    REQUIRE(method->invoke(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12L) == 78L);
+
+    int values[12] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+    std::vector<rtti::variant_ref> args(std::begin(values), std::end(values));
+    // last argument is converted from int to long
+    REQUIRE(method->invokeArgs(args) == 78L);
+
+    long result = 0;
+    REQUIRE(method->invokeArgs(args, &result).empty());
+    REQUIRE(result == 78);
+
+    args.pop_back();
+    REQUIRE_THROWS_AS(method->invokeArgs(args), rtti::invoke_error);
+
+    auto toStr = rtti::MetaNamespace::global()->getMethod("intToStr");
+    REQUIRE(toStr);
+    bool ok = false;
+    rtti::variant_ref pair[] = {std::as_const(values[0]), ok};
+    // Result is constructed in uninitialized storage and destroyed by caller
+    alignas(std::string) unsigned char storage[sizeof(std::string)];
+    REQUIRE(toStr->invokeArgs(pair, storage).empty());
+    auto *text = std::launder(reinterpret_cast<std::string*>(storage));
+    REQUIRE(((*text == "1") && ok));
+    std::destroy_at(text);
+}
+
+TEST_CASE("Test array argument by const reference")
+{
+    auto method = rtti::MetaNamespace::global()->getMethod("lenRef");
+    REQUIRE(method);
+
+    char buf[] = "hello";
+    REQUIRE(method->invoke(buf) == std::size_t{5});
+
+    char const cbuf[] = "hi";
+    REQUIRE(method->invoke(cbuf) == std::size_t{2});
+
+    rtti::variant value = std::ref(buf);
+    REQUIRE(method->invoke(value) == std::size_t{5});
+}
+
+TEST_CASE("Test overloaded method lookup")
+{
+    auto global = rtti::MetaNamespace::global();
+
+    auto first = global->getMethod("overloaded");
+    REQUIRE(first);
+    REQUIRE(first->name() == "overloaded(int)");
+    REQUIRE(global->getMethod("overloaded(int)") == first);
+    REQUIRE(global->getMethod<int>("overloaded") == first);
+
+    auto second = global->getMethod<double>("overloaded");
+    REQUIRE(second);
+    REQUIRE(second != first);
+    REQUIRE(second->name() == "overloaded(double)");
+    REQUIRE(second->invoke(1.5) == 3.0);
+
+    REQUIRE_FALSE(global->getMethod("overloaded(long)"));
+    REQUIRE_FALSE(global->getMethod("overload"));
+    REQUIRE_FALSE(global->getMethod("overloaded("));
+    REQUIRE_FALSE(global->getMethod(""));
+}
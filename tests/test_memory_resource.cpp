@@ -0,0 +1,183 @@
+﻿#define DOCTEST_CONFIG_VOID_CAST_EXPRESSIONS
+#include <doctest/doctest.h>
+#include <rtti/metatype.h>
+#include <rtti/memoryresource.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+class CountingResource final: public rtti::MemoryResource
+{
+public:
+    int allocated = 0;
+    int deallocated = 0;
+
+protected:
+    void* do_allocate(std::size_t size, std::size_t align) override
+    {
+        ++allocated;
+        return rtti::newDeleteResource()->allocate(size, align);
+    }
+
+    void do_deallocate(void *ptr, std::size_t size, std::size_t align) noexcept override
+    {
+        ++deallocated;
+        rtti::newDeleteResource()->deallocate(ptr, size, align);
+    }
+};
+
+struct alignas(32) Wide
+{
+    std::uint8_t bytes[48];
+};
+
+// Allocates from pool while thread is exiting, after the pool was handed back
+struct ExitAllocation
+{
+    ~ExitAllocation()
+    {
+        if (result)
+            *result = rtti::poolResource()->allocate(64, 16);
+    }
+
+    void **result = nullptr;
+};
+
+bool aligned(void *ptr, std::size_t align)
+{
+    return (reinterpret_cast<std::uintptr_t>(ptr) % align) == 0;
+}
+
+} // namespace
+
+TEST_CASE("Memory resources")
+{
+    SUBCASE("type alignment")
+    {
+        REQUIRE(rtti::metaType<Wide>().typeAlign() == 32);
+        REQUIRE(rtti::metaType<Wide const&>().typeAlign() == 32);
+        REQUIRE(rtti::metaType<double>().typeAlign() == alignof(double));
+        REQUIRE(rtti::metaType<void>().typeAlign() == 0);
+    }
+
+    SUBCASE("resource attached to type")
+    {
+        CountingResource resource;
+        auto type = rtti::metaType<std::string>();
+        REQUIRE(type.memoryResource() == nullptr);
+
+        // attached to decayed type
+        rtti::metaType<std::string const&>().setMemoryResource(&resource);
+        REQUIRE(type.memoryResource() == &resource);
+
+        std::string value = "value";
+        auto *instance = static_cast<std::string*>(type.construct(&value));
+        REQUIRE(*instance == "value");
+        type.destruct(instance);
+        REQUIRE(resource.allocated == 1);
+        REQUIRE(resource.deallocated == 1);
+
+        type.setMemoryResource(nullptr);
+        type.destruct(type.construct());
+        REQUIRE(resource.allocated == 1);
+    }
+
+    SUBCASE("resource passed per call")
+    {
+        CountingResource resource;
+        auto type = rtti::metaType<Wide>();
+        auto *instance = type.construct(nullptr, false, &resource);
+        REQUIRE(aligned(instance, 32));
+        type.destruct(instance, &resource);
+        REQUIRE(resource.allocated == 1);
+        REQUIRE(resource.deallocated == 1);
+    }
+
+    SUBCASE("pool reuses freed blocks")
+    {
+        auto *pool = rtti::poolResource();
+        auto *first = pool->allocate(24, 8);
+        pool->deallocate(first, 24, 8);
+        auto *second = pool->allocate(32, 8);
+        REQUIRE(first == second);
+
+        auto *wide = pool->allocate(sizeof(Wide), alignof(Wide));
+        REQUIRE(aligned(wide, alignof(Wide)));
+        pool->deallocate(wide, sizeof(Wide), alignof(Wide));
+        pool->deallocate(second, 32, 8);
+
+        // blocks too large for size classes go upstream
+        auto *large = pool->allocate(100'000, 16);
+        REQUIRE(large);
+        pool->deallocate(large, 100'000, 16);
+    }
+
+    SUBCASE("pool block freed by other thread")
+    {
+        auto *pool = rtti::poolResource();
+        std::vector<void*> blocks;
+        for (auto i = 0; i < 100; ++i)
+            blocks.push_back(pool->allocate(64, 16));
+
+        std::thread{[&]
+        {
+            for (auto *item: blocks)
+                pool->deallocate(item, 64, 16);
+        }}.join();
+
+        // remote frees are reclaimed by owner once its local list runs out
+        std::vector<void*> reused;
+        for (auto i = 0; i < 2100; ++i)
+            reused.push_back(pool->allocate(64, 16));
+        std::sort(std::begin(reused), std::end(reused));
+        for (auto *item: blocks)
+            REQUIRE(std::binary_search(std::begin(reused), std::end(reused), item));
+
+        for (auto *item: reused)
+            pool->deallocate(item, 64, 16);
+    }
+
+    SUBCASE("pool used by exiting thread")
+    {
+        auto *pool = rtti::poolResource();
+        void *blocks[2] = {};
+        for (auto *&block: blocks)
+        {
+            std::thread{[&block, pool]
+            {
+                // Constructed before the pool of thread, so destroyed after it's released
+                thread_local ExitAllocation exit;
+                exit.result = &block;
+                pool->deallocate(pool->allocate(64, 16), 64, 16);
+            }}.join();
+            REQUIRE(block);
+        }
+        REQUIRE(blocks[0] != blocks[1]);
+        for (auto *block: blocks)
+            pool->deallocate(block, 64, 16);
+    }
+
+    SUBCASE("arena")
+    {
+        CountingResource upstream;
+        {
+            rtti::ArenaResource arena{256, &upstream};
+            auto type = rtti::metaType<Wide>();
+            for (auto i = 0; i < 20; ++i)
+            {
+                auto *instance = type.construct(nullptr, false, &arena);
+                REQUIRE(aligned(instance, alignof(Wide)));
+                type.destruct(instance, &arena);
+            }
+            REQUIRE(arena.allocate(10'000, 8));
+            REQUIRE(upstream.allocated > 1);
+            REQUIRE(upstream.deallocated == 0);
+        }
+        REQUIRE(upstream.deallocated == upstream.allocated);
+    }
+}
@@ -3,6 +3,11 @@
 
 #include <rtti/metatype.h>
 
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <utility>
+
 TEST_CASE("Find metatype by type name")
 {
     auto typeId = rtti::metaTypeId<long double>();
@@ -35,3 +40,166 @@ TEST_CASE("Test type size")
     REQUIRE(rtti::metaType<void*>().typeSize() == sizeof(size_t));
 }
 
+template<std::size_t ...I>
+std::array<rtti::MetaType_ID, sizeof...(I)> registerLateTypes(std::index_sequence<I...>)
+{
+    return {rtti::metaTypeId<std::array<short const*, I + 1>>()...};
+}
+
+template<std::size_t ...I>
+std::array<std::string_view, sizeof...(I)> lateTypeNames(std::index_sequence<I...>)
+{
+    return {rtti::type_name<std::array<short const*, I + 1>>()...};
+}
+
+TEST_CASE("Sealed type registry")
+{
+    auto typeId = rtti::metaTypeId<unsigned long long>();
+    rtti::MetaType::sealRegistry();
+    REQUIRE(rtti::MetaType::registrySealed());
+
+    // Lookup of already registered type reads the snapshot
+    REQUIRE(rtti::MetaType{rtti::type_name<unsigned long long>()}.typeId() == typeId);
+    REQUIRE_FALSE(rtti::MetaType{"not a registered type name"}.valid());
+
+    // Late registration is found through overflow of the snapshot
+    REQUIRE_FALSE(rtti::MetaType{rtti::type_name<short const *****&>()}.valid());
+    typeId = rtti::metaTypeId<short const *****&>();
+    REQUIRE(rtti::MetaType{rtti::type_name<short const *****&>()}.typeId() == typeId);
+
+    // Many late registrations
+    auto lateIds = registerLateTypes(std::make_index_sequence<64>{});
+    auto lateNames = lateTypeNames(std::make_index_sequence<64>{});
+    for (std::size_t i = 0; i < lateIds.size(); ++i)
+        REQUIRE(rtti::MetaType{lateNames[i]}.typeId() == lateIds[i]);
+    REQUIRE(rtti::MetaType{rtti::type_name<short const *****&>()}.typeId() == typeId);
+    REQUIRE_FALSE(rtti::MetaType{"not a registered type name"}.valid());
+
+    // Sealing twice is harmless
+    rtti::MetaType::sealRegistry();
+    REQUIRE(rtti::MetaType{rtti::type_name<unsigned long long>()}.valid());
+}
+
+TEST_CASE("Dense type index")
+{
+    REQUIRE(rtti::metaType<void>().index() == 0);
+    REQUIRE_FALSE(rtti::MetaType::fromIndex(0).valid());
+
+    auto type = rtti::metaType<wchar_t const * const &>();
+    REQUIRE(type.index() > 0);
+    REQUIRE(type.index() <= rtti::MetaType::typeCount());
+    REQUIRE(rtti::MetaType::fromIndex(type.index()).typeId() == type.typeId());
+
+    // Decayed type is registered first
+    auto decay = rtti::MetaType{type.decayId()};
+    REQUIRE(decay.index() < type.index());
+
+    REQUIRE_FALSE(rtti::MetaType::fromIndex(rtti::MetaType::typeCount() + 1).valid());
+}
+
+TEST_CASE("Type compatibility")
+{
+    using rtti::MetaType;
+    using rtti::metaType;
+
+    REQUIRE(MetaType::compatible(metaType<int>(), metaType<int const&>()));
+    REQUIRE(MetaType::compatible(metaType<int&>(), metaType<int&>()));
+    REQUIRE_FALSE(MetaType::compatible(metaType<int>(), metaType<int&>()));
+    REQUIRE_FALSE(MetaType::compatible(metaType<int&>(), metaType<int&&>()));
+
+    // const may be added only when every outer level is const
+    REQUIRE(MetaType::compatible(metaType<char**>(), metaType<char const* const*>()));
+    REQUIRE_FALSE(MetaType::compatible(metaType<char**>(), metaType<char const**>()));
+    REQUIRE_FALSE(MetaType::compatible(metaType<char const**>(), metaType<char**>()));
+    REQUIRE_FALSE(MetaType::compatible(metaType<char**>(), metaType<char*>()));
+
+    // array decays to pointer
+    REQUIRE(MetaType::compatible(metaType<int[4]>(), metaType<int*>()));
+    REQUIRE(MetaType::compatible(metaType<int[4]>(), metaType<int const* const&>()));
+    REQUIRE(MetaType::compatible(metaType<int[4]>(), metaType<int[2]>()));
+    REQUIRE_FALSE(MetaType::compatible(metaType<int[2]>(), metaType<int[4]>()));
+}
+
+namespace {
+
+struct Tracked
+{
+    static inline int alive = 0;
+    static inline int throwAt = -1;
+
+    Tracked()
+        : value{7}
+    { track(); }
+    Tracked(Tracked const &other)
+        : value{other.value}
+    { track(); }
+    Tracked(Tracked &&other) noexcept
+        : value{other.value}
+    { ++alive; other.value = 0; }
+    ~Tracked()
+    { --alive; }
+
+    void track()
+    {
+        if (throwAt == alive)
+            throw std::runtime_error{"construction failed"};
+        ++alive;
+    }
+
+    int value;
+};
+
+} // namespace
+
+TEST_CASE("Bulk lifecycle")
+{
+    SUBCASE("trivial type")
+    {
+        auto type = rtti::metaType<double>();
+        double source[4] = {1, 2, 3, 4};
+        double target[4] = {-1, -1, -1, -1};
+        type.construct_n(target, 4);
+        REQUIRE(std::count(std::begin(target), std::end(target), 0.0) == 4);
+        type.copy_n(source, target, 3);
+        REQUIRE(target[2] == 3);
+        REQUIRE(target[3] == 0);
+
+        // array type counts whole arrays
+        int matrix[2][3] = {{1, 2, 3}, {4, 5, 6}};
+        int copy[2][3] = {};
+        rtti::metaType<int[3]>().copy_n(matrix, copy, 2);
+        REQUIRE(copy[1][2] == 6);
+    }
+
+    SUBCASE("non trivial type")
+    {
+        auto type = rtti::metaType<Tracked>();
+        alignas(Tracked) char source[5 * sizeof(Tracked)];
+        alignas(Tracked) char target[5 * sizeof(Tracked)];
+
+        type.construct_n(source, 5);
+        REQUIRE(Tracked::alive == 5);
+        REQUIRE(reinterpret_cast<Tracked*>(source)[4].value == 7);
+
+        type.copy_n(source, target, 5);
+        REQUIRE(Tracked::alive == 10);
+        type.destroy_n(target, 5);
+        REQUIRE(Tracked::alive == 5);
+
+        type.move_n(source, target, 5);
+        REQUIRE(Tracked::alive == 10);
+        REQUIRE(reinterpret_cast<Tracked*>(source)[0].value == 0);
+        REQUIRE(reinterpret_cast<Tracked*>(target)[0].value == 7);
+        type.destroy_n(source, 5);
+        REQUIRE(Tracked::alive == 5);
+
+        // failed copy rolls back constructed elements
+        Tracked::throwAt = 8;
+        REQUIRE_THROWS_AS(type.copy_n(target, source, 5), std::runtime_error);
+        Tracked::throwAt = -1;
+        REQUIRE(Tracked::alive == 5);
+
+        type.destroy_n(target, 5);
+        REQUIRE(Tracked::alive == 0);
+    }
+}
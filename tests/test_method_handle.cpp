@@ -0,0 +1,145 @@
+﻿#define DOCTEST_CONFIG_VOID_CAST_EXPRESSIONS
+#include <doctest/doctest.h>
+#include <rtti/metadefine.h>
+
+#include <string>
+
+namespace test {
+
+struct HandleShape
+{
+    DECLARE_CLASSINFO
+public:
+    virtual ~HandleShape() = default;
+    std::string name() const
+    { return "shape"; }
+    int scaled(int factor) const
+    { return sides * factor; }
+
+    int sides = 0;
+};
+
+struct HandleTriangle: HandleShape
+{
+    DECLARE_CLASSINFO
+public:
+    HandleTriangle()
+    { sides = 3; }
+    std::string name() const
+    { return "triangle"; }
+};
+
+struct HandleSquare: HandleShape
+{
+    DECLARE_CLASSINFO
+public:
+    HandleSquare()
+    { sides = 4; }
+    std::string name() const
+    { return "square"; }
+    // Registered later, shadows scaled() of base
+    int scaled(int factor) const
+    { return sides * factor * 10; }
+};
+
+} // namespace test
+
+RTTI_REGISTER
+{
+    rtti::global_define()
+        ._namespace("test")
+            ._class<test::HandleShape>("HandleShape")
+                ._method("name", &test::HandleShape::name)
+                ._method("scaled", &test::HandleShape::scaled)
+            ._end()
+            ._class<test::HandleTriangle>("HandleTriangle")
+                ._base<test::HandleShape>()
+                ._method("name", &test::HandleTriangle::name)
+            ._end()
+            ._class<test::HandleSquare>("HandleSquare")
+                ._base<test::HandleShape>()
+                ._method("name", &test::HandleSquare::name)
+            ._end()
+        ._end()
+    ;
+}
+
+TEST_CASE("Method handles")
+{
+    test::HandleShape shape;
+    test::HandleTriangle triangle;
+    test::HandleSquare square;
+
+    // Pointers to base, methods are resolved by dynamic type
+    rtti::variant shapes[] = {
+        static_cast<test::HandleShape*>(&shape),
+        static_cast<test::HandleShape*>(&triangle),
+        static_cast<test::HandleShape*>(&square)
+    };
+    char const *names[] = {"shape", "triangle", "square"};
+
+    SUBCASE("Resolution by dynamic type")
+    {
+        auto handle = rtti::method_handle{"name"};
+        REQUIRE(handle.name() == rtti::symbol{"name"});
+
+        for (auto i = 0; i < 5; ++i)
+        {
+            for (std::size_t j = 0; j < std::size(shapes); ++j)
+            {
+                REQUIRE(handle.invoke(shapes[j]).to<std::string>() == names[j]);
+                auto *metaClass = shapes[j].metaClass();
+                REQUIRE(metaClass);
+                REQUIRE(handle.method(shapes[j]) == metaClass->getMethod("name"));
+            }
+        }
+
+        auto const &constSquare = shapes[2];
+        REQUIRE(handle.invoke(constSquare).to<std::string>() == "square");
+    }
+
+    SUBCASE("Inherited method and arguments")
+    {
+        auto handle = rtti::method_handle{rtti::symbol{"scaled"}};
+        for (auto i = 0; i < 3; ++i)
+        {
+            REQUIRE(handle.invoke(shapes[1], 2).to<int>() == 6);
+            REQUIRE(handle.invoke(shapes[2], 2).to<int>() == 8);
+        }
+
+        rtti::variant value = test::HandleTriangle{};
+        REQUIRE(handle.invoke(value, 10).to<int>() == 30);
+    }
+
+    SUBCASE("Errors")
+    {
+        auto handle = rtti::method_handle{"unknown"};
+        REQUIRE_THROWS_AS(handle.invoke(shapes[0]), rtti::runtime_error);
+
+        auto name = rtti::method_handle{"name"};
+        rtti::variant number = 42;
+        REQUIRE_THROWS_AS(name.invoke(number), rtti::runtime_error);
+        REQUIRE_THROWS_AS(name.invoke(rtti::variant{}), rtti::runtime_error);
+        REQUIRE(name.invoke(shapes[1]).to<std::string>() == "triangle");
+    }
+
+    SUBCASE("Later definitions")
+    {
+        auto handle = rtti::method_handle{"scaled"};
+        REQUIRE(handle.invoke(shapes[2], 2).to<int>() == 8);
+        REQUIRE(handle.invoke(shapes[1], 2).to<int>() == 6);
+
+        rtti::global_define()
+            ._namespace("test")
+                ._class<test::HandleSquare>("HandleSquare")
+                    ._method("scaled", &test::HandleSquare::scaled)
+                ._end()
+            ._end();
+
+        // Cached entry of square is outdated, entry of triangle stays valid
+        auto *triangleMethod = handle.method(shapes[1]);
+        REQUIRE(handle.invoke(shapes[2], 2).to<int>() == 80);
+        REQUIRE(handle.method(shapes[1]) == triangleMethod);
+        REQUIRE(handle.invoke(shapes[1], 2).to<int>() == 6);
+    }
+}
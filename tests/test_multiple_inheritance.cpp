@@ -2,6 +2,11 @@
 #include <doctest/doctest.h>
 #include <rtti/metadefine.h>
 
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
 namespace test {
 
 struct BaseZ
@@ -9,6 +14,8 @@ struct BaseZ
     DECLARE_CLASSINFO
 public:
     int m_basez = 128;
+    std::string name() const
+    { return "BaseZ"; }
 };
 
 struct BaseY
@@ -52,6 +59,8 @@ struct DerivedZY2: DerivedZ1, DerivedY1
     DECLARE_CLASSINFO
 public:
     std::string m_derivedzy2 = "Hello, World!";
+    std::string name() const
+    { return "DerivedZY2"; }
 };
 
 struct DerivedZY2BX3: DerivedZY2, BaseX
@@ -64,6 +73,9 @@ struct DerivedZY2X3: DerivedZY2, DerivedX1
     bool m_derivedzy2x3 = true;
 };
 
+struct DerivedLate: DerivedZY2X3
+{};
+
 } // namespace test
 
 RTTI_REGISTER
@@ -71,22 +83,29 @@ RTTI_REGISTER
     rtti::global_define()
         ._namespace("test")
             ._class<test::BaseZ>("BaseZ")
+                ._property("basez", &test::BaseZ::m_basez)
+                ._property("value", &test::BaseZ::m_basez)
+                ._method("name", &test::BaseZ::name)
             ._end()
             ._class<test::BaseY>("BaseY")
             ._end()
             ._class<test::BaseX>("BaseX")
+                ._property("basex", &test::BaseX::m_basex)
+                ._property("value", &test::BaseX::m_basex)
             ._end()
             ._class<test::DerivedZ1>("DerivedZ1")
                 ._base<test::BaseZ>()
             ._end()
             ._class<test::DerivedY1>("DerivedY1")
                 ._base<test::BaseY>()
+                ._property("value", &test::DerivedY1::m_derivedy)
             ._end()
             ._class<test::DerivedX1>("DerivedX1")
                 ._base<test::BaseX>()
             ._end()
             ._class<test::DerivedZY2>("DerivedZY2")
                 ._base<test::DerivedZ1, test::DerivedY1>()
+                ._method("name", &test::DerivedZY2::name)
             ._end()
             ._class<test::DerivedZY2BX3>("DerivedZY2BX3")
                 ._base<test::DerivedZY2, test::BaseX>()
@@ -121,4 +140,162 @@ TEST_CASE("Multiple inheritance")
         REQUIRE(instance.is<test::DerivedZY2>());
         REQUIRE_FALSE(instance.is<test::DerivedX1>());
     }
+
+    SUBCASE("Inherited members lookup")
+    {
+        auto *nsTest = rtti::MetaNamespace::global()->getNamespace("test");
+        REQUIRE(nsTest);
+        auto *mcBaseZ = nsTest->getClass("BaseZ");
+        auto *mcBaseX = nsTest->getClass("BaseX");
+        auto *mcDerivedY1 = nsTest->getClass("DerivedY1");
+        auto *mcDerivedZY2 = nsTest->getClass("DerivedZY2");
+        auto *mcDerived = nsTest->getClass("DerivedZY2BX3");
+        REQUIRE(mcBaseZ);
+        REQUIRE(mcBaseX);
+        REQUIRE(mcDerivedY1);
+        REQUIRE(mcDerivedZY2);
+        REQUIRE(mcDerived);
+
+        // Repeated lookups are served by flattened member table
+        for (auto i = 0; i < 3; ++i)
+        {
+            REQUIRE(mcDerived->getProperty("basez") == mcBaseZ->getProperty("basez"));
+            REQUIRE(mcDerived->getProperty("basex") == mcBaseX->getProperty("basex"));
+            // Members of preceding base shadow members of following bases
+            REQUIRE(mcDerived->getProperty("value") == mcBaseZ->getProperty("value"));
+            REQUIRE(mcDerivedY1->getProperty("value") != mcBaseZ->getProperty("value"));
+            REQUIRE(mcDerived->getProperty("unknown") == nullptr);
+
+            // Members of derived class shadow base members
+            auto *method = mcDerived->getMethod("name");
+            REQUIRE(method);
+            REQUIRE(method == mcDerivedZY2->getMethod("name"));
+            REQUIRE(method != mcBaseZ->getMethod("name"));
+            REQUIRE(mcDerived->getMethod(method->name()) == method);
+        }
+
+        // Later definitions are visible through derived classes
+        rtti::global_define()
+            ._namespace("test")
+                ._class<test::BaseX>("BaseX")
+                    ._property("late", &test::BaseX::m_basex)
+                ._end()
+            ._end();
+
+        for (auto i = 0; i < 3; ++i)
+        {
+            auto *property = mcDerived->getProperty("late");
+            REQUIRE(property);
+            REQUIRE(property == mcBaseX->getProperty("late"));
+        }
+    }
+
+    SUBCASE("Lookup during definition")
+    {
+        auto *nsTest = rtti::MetaNamespace::global()->getNamespace("test");
+        REQUIRE(nsTest);
+        auto *mcBaseX = nsTest->getClass("BaseX");
+        auto *mcDerived = nsTest->getClass("DerivedZY2BX3");
+        REQUIRE(mcBaseX);
+        REQUIRE(mcDerived);
+
+        // Every definition replaces member table of derived class under concurrent lookups
+        std::atomic_bool done = false;
+        std::atomic_int failures = 0;
+        std::vector<std::thread> readers;
+        for (auto i = 0; i < 2; ++i)
+            readers.emplace_back([&]
+            {
+                while (!done.load())
+                    if (mcDerived->getProperty("basex") != mcBaseX->getProperty("basex"))
+                        ++failures;
+            });
+
+        for (auto i = 0; i < 100; ++i)
+        {
+            auto name = "concurrent" + std::to_string(i);
+            rtti::global_define()
+                ._namespace("test")
+                    ._class<test::BaseX>("BaseX")
+                        ._property(name, &test::BaseX::m_basex)
+                    ._end()
+                ._end();
+            REQUIRE(mcDerived->getProperty(name) == mcBaseX->getProperty(name));
+        }
+        done = true;
+        for (auto &thread: readers)
+            thread.join();
+        REQUIRE(failures == 0);
+    }
+
+    SUBCASE("Ancestors")
+    {
+        auto *nsTest = rtti::MetaNamespace::global()->getNamespace("test");
+        REQUIRE(nsTest);
+        auto *mcBaseX = nsTest->getClass("BaseX");
+        auto *mcBaseY = nsTest->getClass("BaseY");
+        auto *mcDerivedX1 = nsTest->getClass("DerivedX1");
+        auto *mcDerivedZY2X3 = nsTest->getClass("DerivedZY2X3");
+        auto *mcDerivedZY2BX3 = nsTest->getClass("DerivedZY2BX3");
+        REQUIRE(mcBaseX);
+        REQUIRE(mcBaseY);
+        REQUIRE(mcDerivedX1);
+        REQUIRE(mcDerivedZY2X3);
+        REQUIRE(mcDerivedZY2BX3);
+
+        for (auto i = 0; i < 3; ++i)
+        {
+            REQUIRE(mcDerivedZY2X3->inheritedFrom(mcBaseX));
+            REQUIRE(mcDerivedZY2X3->inheritedFrom(mcBaseY));
+            REQUIRE(mcDerivedZY2X3->inheritedFrom(mcDerivedX1));
+            REQUIRE_FALSE(mcDerivedZY2BX3->inheritedFrom(mcDerivedX1));
+            REQUIRE_FALSE(mcBaseX->inheritedFrom(mcDerivedX1));
+            REQUIRE_FALSE(mcDerivedZY2X3->inheritedFrom(nullptr));
+        }
+
+        // Class defined later gets ancestors of its bases
+        rtti::global_define()
+            ._namespace("test")
+                ._class<test::DerivedLate>("DerivedLate")
+                    ._base<test::DerivedZY2X3>()
+                ._end()
+            ._end();
+
+        auto *mcDerivedLate = nsTest->getClass("DerivedLate");
+        REQUIRE(mcDerivedLate);
+        REQUIRE(mcDerivedLate->inheritedFrom(mcDerivedX1));
+        REQUIRE(mcDerivedLate->inheritedFrom(mcBaseY));
+        REQUIRE_FALSE(mcDerivedZY2X3->inheritedFrom(mcDerivedLate));
+
+        auto instance = test::DerivedLate{};
+        instance.m_basex = 42;
+        REQUIRE(rtti::variant{&instance}.to<test::BaseX*>()->m_basex == 42);
+        REQUIRE(rtti::variant{std::ref(instance)}.ref<test::DerivedY1>().m_derivedy == instance.m_derivedy);
+
+        // Redefinition of base rebuilds ancestors of its subtree under concurrent casts
+        std::atomic_bool done = false;
+        std::atomic_int failures = 0;
+        std::vector<std::thread> readers;
+        for (auto i = 0; i < 2; ++i)
+            readers.emplace_back([&]
+            {
+                while (!done.load())
+                    if (!mcDerivedLate->inheritedFrom(mcBaseX) ||
+                        rtti::variant{&instance}.to<test::BaseX*>() != static_cast<test::BaseX*>(&instance))
+                        ++failures;
+            });
+
+        for (auto i = 0; i < 100; ++i)
+            rtti::global_define()
+                ._namespace("test")
+                    ._class<test::DerivedZY2X3>("DerivedZY2X3")
+                        ._base<test::DerivedX1>()
+                    ._end()
+                ._end();
+        done = true;
+        for (auto &thread: readers)
+            thread.join();
+        REQUIRE(failures == 0);
+        REQUIRE(mcDerivedZY2X3->baseClassCount() == 2);
+    }
 }
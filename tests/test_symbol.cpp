@@ -0,0 +1,122 @@
+﻿#define DOCTEST_CONFIG_VOID_CAST_EXPRESSIONS
+#include <doctest/doctest.h>
+#include <rtti/metadefine.h>
+
+#include <string>
+
+namespace test {
+
+struct SymbolBase
+{
+    DECLARE_CLASSINFO
+public:
+    int value = 1;
+    int twice() const
+    { return value * 2; }
+};
+
+struct SymbolDerived: SymbolBase
+{
+    DECLARE_CLASSINFO
+public:
+    int add(int other) const
+    { return value + other; }
+};
+
+} // namespace test
+
+RTTI_REGISTER
+{
+    rtti::global_define()
+        ._namespace("test")
+            ._class<test::SymbolBase>("SymbolBase")
+                ._attribute("Description", "Symbol base")
+                ._property("value", &test::SymbolBase::value)
+                ._method("twice", &test::SymbolBase::twice)
+            ._end()
+            ._class<test::SymbolDerived>("SymbolDerived")
+                ._base<test::SymbolBase>()
+                ._method("add", &test::SymbolDerived::add)
+            ._end()
+        ._end()
+    ;
+}
+
+TEST_CASE("Symbols")
+{
+    using namespace std::literals;
+
+    SUBCASE("Interning")
+    {
+        auto first = rtti::symbol{"symbol_interning_test"};
+        auto second = rtti::symbol{"symbol_interning_"s + "test"};
+        REQUIRE(first == second);
+        REQUIRE(first.id() == second.id());
+        REQUIRE(first.id() != 0);
+        REQUIRE(first.hash() == std::hash<std::string_view>{}("symbol_interning_test"));
+        REQUIRE(std::hash<rtti::symbol>{}(first) == first.hash());
+        REQUIRE(first.str() == "symbol_interning_test");
+        REQUIRE(rtti::symbol::find("symbol_interning_test") == first);
+        REQUIRE(rtti::symbol{"symbol_interning_other"} != first);
+
+        REQUIRE(rtti::symbol::find("symbol_never_interned").empty());
+        REQUIRE(rtti::symbol{}.empty());
+        REQUIRE(rtti::symbol{""}.empty());
+        REQUIRE(rtti::symbol{}.id() == 0);
+        REQUIRE(rtti::symbol{}.str().empty());
+    }
+
+    SUBCASE("Lookup")
+    {
+        auto *nsTest = rtti::MetaNamespace::global()->getNamespace(rtti::symbol{"test"});
+        REQUIRE(nsTest);
+        REQUIRE(nsTest == rtti::MetaNamespace::global()->getNamespace("test"));
+
+        auto *mcBase = nsTest->getClass(rtti::symbol{"SymbolBase"});
+        auto *mcDerived = nsTest->getClass(rtti::symbol{"SymbolDerived"});
+        REQUIRE(mcBase);
+        REQUIRE(mcDerived);
+        REQUIRE(mcBase == nsTest->getClass("SymbolBase"));
+        REQUIRE(nsTest->getClass(rtti::symbol{"SymbolUnknown"}) == nullptr);
+
+        auto &description = mcBase->attribute(rtti::symbol{"Description"});
+        REQUIRE(description.to<std::string>() == "Symbol base");
+        REQUIRE(mcBase->attribute(rtti::symbol{"Unknown"}).empty());
+
+        // Repeated lookups go through flattened member table of class
+        for (auto i = 0; i < 3; ++i)
+        {
+            auto *twice = mcDerived->getMethod(rtti::symbol{"twice"});
+            REQUIRE(twice);
+            REQUIRE(twice == mcBase->getMethod("twice"));
+            REQUIRE(mcDerived->getMethod(rtti::symbol{twice->name()}) == twice);
+            REQUIRE(mcDerived->getMethod(rtti::symbol{"add"}) == mcDerived->getMethod("add"));
+            REQUIRE(mcDerived->getMethod(rtti::symbol{"unknown"}) == nullptr);
+            REQUIRE(mcBase->getMethod(rtti::symbol{"add"}) == nullptr);
+
+            auto *value = mcDerived->getProperty(rtti::symbol{"value"});
+            REQUIRE(value);
+            REQUIRE(value == mcBase->getProperty("value"));
+        }
+    }
+
+    SUBCASE("Variant")
+    {
+        auto const twice = rtti::symbol{"twice"};
+        auto const add = rtti::symbol{"add"};
+        auto const value = rtti::symbol{"value"};
+
+        rtti::variant instance = test::SymbolDerived{};
+        REQUIRE(instance.invoke(twice).to<int>() == 2);
+        REQUIRE(instance.invoke(add, 41).to<int>() == 42);
+        instance.set_property(value, 10);
+        REQUIRE(instance.get_property(value).to<int>() == 10);
+        REQUIRE(instance.invoke(twice).to<int>() == 20);
+
+        auto const &constInstance = instance;
+        REQUIRE(constInstance.invoke(add, 1).to<int>() == 11);
+
+        REQUIRE_THROWS_AS(instance.invoke(rtti::symbol{"unknown"}), rtti::runtime_error);
+        REQUIRE_THROWS_AS(instance.get_property(rtti::symbol{"unknown"}), rtti::runtime_error);
+    }
+}
@@ -2,6 +2,10 @@
 #include <doctest/doctest.h>
 #include <rtti/metadefine.h>
 
+#include <array>
+#include <thread>
+#include <vector>
+
 namespace {
 
 uint16_t explicit_constructed = 0;
@@ -450,7 +454,7 @@ TEST_CASE("Variant D-Q Pointers")
                     (explicit_constructed == 0)
                     && (default_constructed == 0)
                     && (copy_constructed == 1)
-                    && (move_constructed == 5)
+                    && (move_constructed == 4)
                     && (copy_assigned == 0)
                     && (move_assigned == 0)
                     && (destroyed == 4)
@@ -458,3 +462,320 @@ TEST_CASE("Variant D-Q Pointers")
 
     }
 }
+
+namespace {
+
+struct alignas(64) OverAligned
+{
+    int value = 0;
+    bool operator==(OverAligned const &other) const
+    { return value == other.value; }
+};
+
+} // namespace
+
+TEST_CASE("Variant inline storage")
+{
+    using namespace rtti::internal;
+
+    REQUIRE(sizeof(variant_type_storage) == STORAGE_SIZE);
+    REQUIRE(is_inplace_v<void*[2]>);
+    REQUIRE_FALSE(is_inplace_v<char[STORAGE_SIZE + 1]>);
+    // Small but over-aligned type goes to heap
+    REQUIRE_FALSE(is_inplace_v<OverAligned>);
+
+    rtti::variant v = OverAligned{42};
+    REQUIRE(reinterpret_cast<std::uintptr_t>(&v.cref<OverAligned>()) % alignof(OverAligned) == 0);
+    rtti::variant copy = v;
+    REQUIRE(copy.cref<OverAligned>().value == 42);
+}
+
+namespace {
+
+struct SharedBlob
+{
+    static inline int copies = 0;
+
+    SharedBlob() = default;
+    SharedBlob(SharedBlob const &other)
+        : data{other.data}
+    { ++copies; }
+    SharedBlob& operator=(SharedBlob const&) = default;
+
+    bool operator==(SharedBlob const &other) const
+    { return data == other.data; }
+
+    std::array<int, 32> data = {};
+};
+
+} // namespace
+
+namespace rtti {
+
+template<>
+struct variant_copy_on_write<SharedBlob>: std::true_type
+{};
+
+} // namespace rtti
+
+TEST_CASE("Variant heap storage")
+{
+    SUBCASE("Cross thread destruction")
+    {
+        using Large = std::array<int, 64>;
+        std::vector<rtti::variant> values;
+        for (auto i = 0; i < 100; ++i)
+            values.emplace_back(Large{i});
+
+        std::thread{[&values]
+        {
+            for (auto i = 0; i < 100; ++i)
+                REQUIRE(values[static_cast<std::size_t>(i)].cref<Large>()[0] == i);
+            values.clear();
+        }}.join();
+
+        rtti::variant v = Large{1};
+        rtti::variant copy = v;
+        REQUIRE(&copy.cref<Large>() != &v.cref<Large>());
+    }
+
+    SUBCASE("Copy-on-write")
+    {
+        SharedBlob::copies = 0;
+        rtti::variant v = SharedBlob{};
+        auto copies = SharedBlob::copies;
+
+        rtti::variant copy = v;
+        rtti::variant other = copy;
+        REQUIRE(SharedBlob::copies == copies);
+        REQUIRE(&copy.cref<SharedBlob>() == &v.cref<SharedBlob>());
+        REQUIRE(other == v);
+
+        copy.ref<SharedBlob>().data[0] = 7;
+        REQUIRE(SharedBlob::copies == copies + 1);
+        REQUIRE(&copy.cref<SharedBlob>() != &v.cref<SharedBlob>());
+        REQUIRE(copy.cref<SharedBlob>().data[0] == 7);
+        REQUIRE(v.cref<SharedBlob>().data[0] == 0);
+        REQUIRE(&other.cref<SharedBlob>() == &v.cref<SharedBlob>());
+
+        // Unique value isn't copied again
+        copy.ref<SharedBlob>().data[1] = 8;
+        REQUIRE(SharedBlob::copies == copies + 1);
+
+        other.clear();
+        v.ref<SharedBlob>().data[0] = 1;
+        REQUIRE(SharedBlob::copies == copies + 1);
+    }
+
+    SUBCASE("Failed cast keeps value shared")
+    {
+        SharedBlob::copies = 0;
+        rtti::variant v = SharedBlob{};
+        rtti::variant copy = v;
+        auto copies = SharedBlob::copies;
+
+        REQUIRE(copy.try_ref<std::string>() == nullptr);
+        REQUIRE_THROWS_AS(copy.ref<std::string>(), rtti::bad_variant_cast);
+        REQUIRE(SharedBlob::copies == copies);
+        REQUIRE(&copy.cref<SharedBlob>() == &v.cref<SharedBlob>());
+
+        REQUIRE(copy.try_ref<SharedBlob const>() != nullptr);
+        REQUIRE(SharedBlob::copies == copies);
+    }
+}
+
+TEST_CASE("Variant relocation")
+{
+    using namespace rtti::internal;
+
+    REQUIRE(variant_function_table_for<void>()->trivially_relocatable);
+    REQUIRE(variant_function_table_for<int>()->trivially_copyable);
+    REQUIRE(variant_function_table_for<std::reference_wrapper<std::string>>()->trivially_copyable);
+    REQUIRE_FALSE(variant_function_table_for<std::string>()->trivially_copyable);
+    REQUIRE(variant_function_table_for<std::string>()->trivially_relocatable);
+
+    std::vector<rtti::variant> values;
+    for (auto i = 0; i < 100; ++i)
+    {
+        if (i % 2)
+            values.emplace_back(i);
+        else
+            values.emplace_back(std::to_string(i));
+    }
+    for (auto i = 0; i < 100; ++i)
+    {
+        auto &value = values[static_cast<std::size_t>(i)];
+        if (i % 2)
+            REQUIRE(value.cref<int>() == i);
+        else
+            REQUIRE(value.cref<std::string>() == std::to_string(i));
+    }
+
+    rtti::variant a = 1;
+    rtti::variant b = std::string{"text"};
+    rtti::swap(a, b);
+    REQUIRE(a.cref<std::string>() == "text");
+    REQUIRE(b.cref<int>() == 1);
+
+    rtti::variant c = std::move(a);
+    REQUIRE(a.empty());
+    REQUIRE(c.cref<std::string>() == "text");
+}
+
+TEST_CASE("Variant exact type access")
+{
+    rtti::variant v = 42;
+    REQUIRE(v.is<int>());
+    REQUIRE(v.is<int const&>());
+    REQUIRE(&v.ref<int>() == &v.cref<int>());
+    REQUIRE(v.data<int>() == &v.cref<int>());
+    v.ref<int>() = 7;
+    REQUIRE(std::as_const(v).cref<int>() == 7);
+    REQUIRE_FALSE(v.data<long>());
+
+    // Variant keeps its own copy of const value
+    int const value = 5;
+    rtti::variant c = value;
+    REQUIRE(c.cref<int>() == 5);
+    REQUIRE(c.is<int&>());
+    REQUIRE_FALSE(std::as_const(c).is<int&>());
+    REQUIRE(&c.ref<int>() == &c.cref<int>());
+    REQUIRE_THROWS_AS(c.ref<long>(), rtti::bad_variant_cast);
+
+    rtti::variant s = std::string{"text"};
+    REQUIRE(s.is<std::string>());
+    REQUIRE(s.ref<std::string>() == "text");
+    REQUIRE(std::move(s).rref<std::string>() == "text");
+
+    // Reference wrapper is unwrapped, never exposed as itself
+    int x = 3;
+    rtti::variant r = std::ref(x);
+    REQUIRE_FALSE(r.is<std::reference_wrapper<int>>());
+    REQUIRE_FALSE(r.data<std::reference_wrapper<int>>());
+    REQUIRE(r.is<int>());
+    REQUIRE(r.data<int>() == &x);
+}
+
+TEST_CASE("Variant non-throwing access")
+{
+    rtti::variant empty;
+    REQUIRE_FALSE(empty.try_ref<int>());
+    REQUIRE_FALSE(empty.try_to<int>());
+    int result = 1;
+    REQUIRE(empty.convert(result) == rtti::variant_error::EMPTY);
+    REQUIRE(result == 1);
+
+    rtti::variant v = std::string{"text"};
+    REQUIRE(v.try_ref<std::string>());
+    REQUIRE(*v.try_ref<std::string>() == "text");
+    REQUIRE_FALSE(v.try_ref<int>());
+    REQUIRE(v.try_to<std::string>() == std::optional<std::string>{"text"});
+    REQUIRE_FALSE(v.try_to<std::vector<int>>());
+    REQUIRE(v.convert(result) == rtti::variant_error::INCOMPATIBLE);
+    REQUIRE(result == 1);
+
+    rtti::variant number = 5;
+    REQUIRE(number.convert(result) == rtti::variant_error::NONE);
+    REQUIRE(result == 5);
+    REQUIRE_FALSE(number.tryConvert<std::vector<int>>());
+    REQUIRE(number.cref<int>() == 5);
+
+    // Throwing API reports the same failures
+    REQUIRE_THROWS_AS(empty.ref<int>(), rtti::bad_variant_cast);
+    REQUIRE_THROWS_AS(v.to<std::vector<int>>(), rtti::bad_variant_convert);
+}
+
+TEST_CASE("Variant reference argument")
+{
+    using namespace std::literals;
+
+    rtti::variant_ref empty;
+    REQUIRE(empty.empty());
+    REQUIRE(empty.get().empty());
+    REQUIRE_THROWS_AS(rtti::argument{empty}.value<int>(), rtti::bad_argument_cast);
+
+    int number = 5;
+    rtti::variant_ref lvalue = number;
+    REQUIRE_FALSE(lvalue.isRValue());
+    REQUIRE(lvalue.data<int>() == &number);
+    REQUIRE(lvalue.data<int const>() == &number);
+    REQUIRE_FALSE(lvalue.data<long>());
+    REQUIRE(lvalue.get().is<int&>());
+    rtti::argument{lvalue}.value<int&>() = 6;
+    REQUIRE(number == 6);
+
+    int const cnumber = 7;
+    rtti::variant_ref clvalue = cnumber;
+    REQUIRE_FALSE(clvalue.data<int>());
+    REQUIRE(clvalue.data<int const>() == &cnumber);
+    REQUIRE(clvalue.get().is<int const&>());
+    REQUIRE(rtti::argument{clvalue}.value<int const&>() == 7);
+    REQUIRE_THROWS_AS(rtti::argument{clvalue}.value<int&>(), rtti::bad_variant_cast);
+
+    auto text = "text"s;
+    rtti::variant_ref rvalue = std::move(text);
+    REQUIRE(rvalue.isRValue());
+    REQUIRE_THROWS_AS(rtti::argument{rvalue}.value<std::string&>(), rtti::bad_variant_cast);
+    {
+        rtti::argument arg = rvalue;
+        auto moved = arg.value<std::string&&>();
+        REQUIRE(moved == "text");
+    }
+
+    // Conversion storage lives as long as argument
+    short small = 8;
+    REQUIRE(rtti::argument{rtti::variant_ref{small}}.value<int const&>() == 8);
+    REQUIRE(rtti::argument{rtti::variant_ref{number}}.value<std::string>() == "6");
+
+    // Variant argument is unwrapped
+    rtti::variant holder = 9;
+    REQUIRE(rtti::argument{rtti::variant_ref{holder}}.value<int>() == 9);
+    REQUIRE(&rtti::argument{rtti::variant_ref{holder}}.value<rtti::variant const&>() == &holder);
+}
+
+TEST_CASE("Method delegates")
+{
+    using namespace std::literals;
+
+    auto *metaClass = rtti::MetaClass::find(rtti::metaTypeId<test::TestQPointer>());
+    REQUIRE(metaClass);
+
+    auto *value = metaClass->getMethod("value");
+    REQUIRE(value);
+    auto setValue = value->bind<std::string&(test::TestQPointer&)>();
+    static_assert(std::is_trivially_copyable_v<decltype(setValue)>);
+    REQUIRE(setValue);
+
+    test::TestQPointer qp{"Hello"};
+    setValue(qp) = "World";
+    REQUIRE(qp.value() == "World");
+
+    auto *constValue = metaClass->getMethod("const_value");
+    REQUIRE(constValue);
+    auto getValue = constValue->bind<std::string const&(test::TestQPointer const&)>();
+    REQUIRE(&getValue(qp) == &qp.value());
+    // const method can be called through non const reference
+    REQUIRE(constValue->bind<std::string const&(test::TestQPointer&)>()(qp) == "World");
+
+    auto *check = metaClass->getMethod("check");
+    REQUIRE(check);
+    REQUIRE(check->bind<bool(test::TestQPointer const&)>()(qp));
+
+    // non const method can't be bound to const reference
+    REQUIRE_THROWS_AS(value->bind<std::string&(test::TestQPointer const&)>(), rtti::invoke_error);
+    // exact parameter and result types are required
+    REQUIRE_THROWS_AS(check->bind<int(test::TestQPointer const&)>(), rtti::invoke_error);
+    REQUIRE_THROWS_AS(check->bind<bool()>(), rtti::invoke_error);
+
+    auto *intToStr = rtti::MetaNamespace::global()->getMethod("intToStr");
+    REQUIRE(intToStr);
+    auto toStr = intToStr->bind<std::string(int, bool&)>();
+    bool ok = false;
+    REQUIRE(toStr(42, ok) == "42");
+    REQUIRE(ok);
+    REQUIRE_THROWS_AS(intToStr->bind<std::string(long, bool&)>(), rtti::invoke_error);
+    REQUIRE_THROWS_AS(intToStr->bind<std::string(int, bool)>(), rtti::invoke_error);
+
+    rtti::method_delegate<bool()> empty;
+    REQUIRE_FALSE(empty);
+}
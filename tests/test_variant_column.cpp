@@ -0,0 +1,168 @@
+﻿#define DOCTEST_CONFIG_VOID_CAST_EXPRESSIONS
+#include <doctest/doctest.h>
+#include <rtti/variant_column.h>
+
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+int alive = 0;
+bool failMove = false;
+
+struct Brittle
+{
+    Brittle(int value)
+        : value{value}
+    { ++alive; }
+    Brittle(Brittle const &other)
+        : value{other.value}
+    { ++alive; }
+    Brittle(Brittle &&other)
+        : value{other.value}
+    {
+        if (failMove)
+            throw std::runtime_error{"move failed"};
+        ++alive;
+    }
+    ~Brittle()
+    { --alive; }
+
+    int value;
+};
+
+} // namespace
+
+TEST_CASE("Variant column")
+{
+    using namespace std::literals;
+
+    SUBCASE("trivial type")
+    {
+        auto column = rtti::variant_column::create<int>();
+        REQUIRE(column.type().typeId() == rtti::metaTypeId<int>());
+        REQUIRE(column.empty());
+
+        for (int i = 0; i < 100; ++i)
+            column.push_back(i);
+        REQUIRE(column.size() == 100);
+        REQUIRE(column.capacity() >= 100);
+
+        auto values = column.values<int>();
+        REQUIRE(values.size() == 100);
+        REQUIRE(std::accumulate(values.begin(), values.end(), 0) == 4950);
+        REQUIRE_THROWS_AS(column.values<long>(), rtti::bad_variant_cast);
+
+        column.erase(0);
+        column.erase(10, 20);
+        REQUIRE(column.size() == 89);
+        REQUIRE(column.values<int>().front() == 1);
+        REQUIRE(column.values<int>()[10] == 21);
+        REQUIRE(column.values<int>().back() == 99);
+
+        column.resize(100);
+        REQUIRE(column.values<int>().back() == 0);
+        column.resize(1);
+        REQUIRE(column.size() == 1);
+        REQUIRE_THROWS_AS(column.erase(1), rtti::runtime_error);
+
+        column.clear();
+        REQUIRE(column.empty());
+    }
+
+    SUBCASE("non trivial type")
+    {
+        auto column = rtti::variant_column::create<std::string>();
+        auto text = "some long text that surely lives on the heap"s;
+        for (int i = 0; i < 20; ++i)
+            column.push_back(text + std::to_string(i));
+
+        column.erase(5, 15);
+        REQUIRE(column.size() == 10);
+        REQUIRE(column.values<std::string>()[5] == text + "15");
+
+        // element of column itself survives reallocation
+        while (column.size() < column.capacity() - 1)
+            column.push_back(text);
+        auto size = column.size();
+        column.push_back(column.values<std::string>()[0]);
+        REQUIRE(column.size() == column.capacity());
+        column.push_back(column.cref(1));
+        REQUIRE(column.size() == size + 2);
+        REQUIRE(column.values<std::string>()[size] == text + "0");
+        REQUIRE(column.values<std::string>()[size + 1] == text + "1");
+
+        auto copy = column;
+        REQUIRE(copy.size() == column.size());
+        REQUIRE(copy.values<std::string>()[size + 1] == text + "1");
+        REQUIRE(copy.data() != column.data());
+
+        auto moved = std::move(copy);
+        REQUIRE(moved.size() == size + 2);
+        REQUIRE(copy.empty());
+    }
+
+    SUBCASE("conversion")
+    {
+        auto column = rtti::variant_column::create<std::string>();
+        column.push_back(rtti::variant{42});
+        column.push_back(3);
+        REQUIRE(column.values<std::string>()[0] == "42");
+        REQUIRE(column.values<std::string>()[1] == "3");
+        REQUIRE_THROWS_AS(column.push_back(rtti::variant{}), rtti::bad_variant_convert);
+        REQUIRE(column.size() == 2);
+    }
+
+    SUBCASE("throwing move")
+    {
+        {
+            auto column = rtti::variant_column::create<Brittle>();
+            column.reserve(8);
+            for (int i = 0; i < 5; ++i)
+                column.push_back(Brittle{i});
+            REQUIRE(alive == 5);
+
+            failMove = true;
+            REQUIRE_THROWS_AS(column.erase(1, 2), std::runtime_error);
+            failMove = false;
+            REQUIRE(column.size() == 1);
+            REQUIRE(column.values<Brittle>()[0].value == 0);
+            REQUIRE(alive == 1);
+
+            column.push_back(Brittle{7});
+            column.erase(0);
+            REQUIRE(column.values<Brittle>()[0].value == 7);
+        }
+        REQUIRE(alive == 0);
+
+        auto column = rtti::variant_column::create<int>();
+        REQUIRE_THROWS_AS(column.reserve(std::numeric_limits<std::size_t>::max()), std::length_error);
+        REQUIRE(column.empty());
+    }
+
+    SUBCASE("cell variants")
+    {
+        auto column = rtti::variant_column::create<int>();
+        column.resize(3);
+
+        auto cell = column.ref(1);
+        REQUIRE(cell.is<int&>());
+        cell.ref<int>() = 10;
+        REQUIRE(column.values<int>()[1] == 10);
+
+        auto const &constColumn = column;
+        auto ccell = constColumn.cref(1);
+        REQUIRE(ccell.is<int const&>());
+        REQUIRE_FALSE(ccell.is<int&>());
+        REQUIRE(ccell.cref<int>() == 10);
+
+        auto value = column.value(1);
+        REQUIRE(value.is<int>());
+        value.ref<int>() = 20;
+        REQUIRE(column.values<int>()[1] == 10);
+
+        REQUIRE_THROWS_AS(column.value(3), rtti::runtime_error);
+    }
+}
@@ -0,0 +1,86 @@
+﻿#define DOCTEST_CONFIG_VOID_CAST_EXPRESSIONS
+#include <doctest/doctest.h>
+#include <rtti/variant_map.h>
+
+#include <string>
+
+namespace {
+
+struct Opaque
+{
+    int value = 0;
+    bool operator==(Opaque const &other) const
+    { return value == other.value; }
+};
+
+} // namespace
+
+TEST_CASE("Variant hash")
+{
+    using namespace std::literals;
+
+    REQUIRE(rtti::metaType<std::string>().isHashable());
+    REQUIRE(rtti::metaType<int const&>().isHashable());
+    REQUIRE_FALSE(rtti::metaType<Opaque>().isHashable());
+
+    auto text = "some long text that surely lives on the heap"s;
+    rtti::variant a = text;
+    rtti::variant b = std::string{text};
+    REQUIRE(a == b);
+    REQUIRE(std::hash<rtti::variant>{}(a) == std::hash<rtti::variant>{}(b));
+    REQUIRE(a.hash() == std::hash<std::string>{}(text));
+    REQUIRE(rtti::variant{std::cref(text)}.hash() == a.hash());
+    REQUIRE(rtti::metaType<std::string>().hash(&text) == a.hash());
+
+    rtti::variant x = Opaque{1};
+    rtti::variant y = Opaque{2};
+    REQUIRE(x.hash() == y.hash());
+    REQUIRE(rtti::variant{}.hash() == 0);
+}
+
+TEST_CASE("Variant map")
+{
+    using namespace std::literals;
+
+    rtti::variant_map<int> map;
+    REQUIRE(map.empty());
+    REQUIRE_FALSE(map.find(1));
+
+    for (auto i = 0; i < 1000; ++i)
+        REQUIRE(map.try_emplace(i, i * 2).second);
+    REQUIRE(map.try_emplace("name"s, -1).second);
+    REQUIRE_FALSE(map.try_emplace(5, 0).second);
+    REQUIRE(map.size() == 1001);
+    REQUIRE(map.size() * 8 <= map.capacity() * 7);
+
+    REQUIRE(*map.find(5) == 10);
+    REQUIRE(*map.find("name"s) == -1);
+    REQUIRE_FALSE(map.find(5L));
+    REQUIRE_FALSE(map.find("other"s));
+
+    map.insert_or_assign(5, 50);
+    REQUIRE(*map.find(5) == 50);
+    map[rtti::variant{7}] = 70;
+    REQUIRE(*map.find(7) == 70);
+
+    for (auto i = 0; i < 1000; i += 2)
+        REQUIRE(map.erase(i));
+    REQUIRE_FALSE(map.erase(0));
+    REQUIRE(map.size() == 501);
+    for (auto i = 1; i < 1000; i += 2)
+        REQUIRE(map.contains(i));
+    for (auto i = 0; i < 1000; i += 2)
+        REQUIRE_FALSE(map.contains(i));
+
+    auto count = std::size_t{0};
+    map.for_each([&count](rtti::variant const&, int&)
+    {
+        ++count;
+        return true;
+    });
+    REQUIRE(count == map.size());
+
+    map.clear();
+    REQUIRE(map.empty());
+    REQUIRE_FALSE(map.find(1));
+}
@@ -100,4 +100,24 @@ TEST_CASE("Virtual inheritance")
         REQUIRE(instance.is<test::DiamondTop>());
     }
 
+    SUBCASE("Repeated casts")
+    {
+        static_assert(rtti::internal::is_virtual_base_of<test::DiamondLeft, test::DiamondTop>::value);
+        static_assert(!rtti::internal::is_virtual_base_of<test::DiamondBottom, test::DiamondRight>::value);
+
+        test::DiamondLeft left;
+        test::DiamondTop *ptr_left_top = &left;
+        for (auto i = 0; i < 3; ++i)
+        {
+            // Non-virtual path
+            REQUIRE(rtti::meta_cast<test::DiamondRight>(ptr_top) == static_cast<test::DiamondRight*>(&bottom));
+            REQUIRE(rtti::meta_cast<test::DiamondLeft>(ptr_top) == static_cast<test::DiamondLeft*>(&bottom));
+            // Offset of virtual base depends on dynamic type
+            REQUIRE(rtti::meta_cast<test::DiamondTop>(&bottom) == ptr_top);
+            REQUIRE(rtti::meta_cast<test::DiamondTop>(static_cast<test::DiamondLeft*>(&bottom)) == ptr_top);
+            REQUIRE(rtti::meta_cast<test::DiamondTop>(&left) == ptr_left_top);
+            REQUIRE(rtti::meta_cast<test::DiamondLeft>(ptr_left_top) == &left);
+            REQUIRE_FALSE(rtti::meta_cast<test::DiamondRight>(ptr_left_top));
+        }
+    }
 }